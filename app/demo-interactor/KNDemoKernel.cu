@@ -70,7 +70,7 @@ move_kernel(ParamsDeviceRef const params, StateDeviceRef const states)
 
     // Construct particle accessor from immutable and thread-local data
     ParticleTrackView particle(params.particle, states.particle, ThreadId(tid));
-    RngEngine         rng(states.rng, ThreadId(tid));
+    RngEngine         rng(params.rng, states.rng, ThreadId(tid));
 
     // Move to collision
     XsCalculator calc_xs(params.tables.xs, params.tables.reals);
@@ -105,7 +105,7 @@ interact_kernel(ParamsDeviceRef const params, StateDeviceRef const states)
 
     // Construct particle accessor from immutable and thread-local data
     ParticleTrackView particle(params.particle, states.particle, ThreadId(tid));
-    RngEngine         rng(states.rng, ThreadId(tid));
+    RngEngine         rng(params.rng, states.rng, ThreadId(tid));
 
     Detector detector(params.detector, states.detector);
 
@@ -39,8 +39,8 @@ struct TableData
     template<class T>
     using Items = celeritas::Collection<T, W, M>;
 
-    Items<celeritas::real_type> reals;
-    celeritas::XsGridData       xs;
+    Items<celeritas::table_real_type> reals;
+    celeritas::XsGridData             xs;
 
     //// MEMBER FUNCTIONS ////
 
@@ -69,6 +69,7 @@ struct ParamsData
     TableData<W, M>                         tables;
     celeritas::detail::KleinNishinaData     kn_interactor;
     DetectorParamsData                      detector;
+    celeritas::RngParamsData<W, M>          rng;
 
     explicit CELER_FUNCTION operator bool() const
     {
@@ -83,6 +84,7 @@ struct ParamsData
         particle      = other.particle;
         tables        = other.tables;
         kn_interactor = other.kn_interactor;
+        rng           = other.rng;
         return *this;
     }
 };
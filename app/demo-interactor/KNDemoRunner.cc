@@ -89,6 +89,7 @@ auto KNDemoRunner::operator()(KNDemoRunArgs args) -> result_type
     params.tables        = xsparams_->device_ref();
     params.kn_interactor = kn_data_;
     params.detector      = detector_params;
+    params.rng           = rng_params;
 
     InitialData initial;
     initial.particle
@@ -7,6 +7,9 @@
 //---------------------------------------------------------------------------//
 #include "LDemoIO.hh"
 
+#include <algorithm>
+#include <limits>
+#include "comm/Communicator.hh"
 #include "comm/Logger.hh"
 #include "geometry/GeoMaterialParams.hh"
 #include "geometry/GeoParams.hh"
@@ -41,12 +44,20 @@ void to_json(nlohmann::json& j, const LDemoArgs& v)
     j = nlohmann::json{{"geometry_filename", v.geometry_filename},
                        {"physics_filename", v.physics_filename},
                        {"hepmc3_filename", v.hepmc3_filename},
+                       {"physics_cache", v.physics_cache},
                        {"seed", v.seed},
                        {"max_num_tracks", v.max_num_tracks},
                        {"max_steps", v.max_steps},
                        {"storage_factor", v.storage_factor},
                        {"secondary_stack_factor", v.secondary_stack_factor},
-                       {"use_device", v.use_device}};
+                       {"use_device", v.use_device},
+                       {"sort_tracks", v.sort_tracks},
+                       {"time_stages", v.time_stages},
+                       {"compact_tracks", v.compact_tracks},
+                       {"max_batch_primaries", v.max_batch_primaries},
+                       {"total_xs_table", v.total_xs_table},
+                       {"element_cdf", v.element_cdf},
+                       {"pe_macro_xs_table", v.pe_macro_xs_table}};
 }
 
 void from_json(const nlohmann::json& j, LDemoArgs& v)
@@ -54,12 +65,44 @@ void from_json(const nlohmann::json& j, LDemoArgs& v)
     j.at("geometry_filename").get_to(v.geometry_filename);
     j.at("physics_filename").get_to(v.physics_filename);
     j.at("hepmc3_filename").get_to(v.hepmc3_filename);
+    if (j.count("physics_cache"))
+    {
+        j.at("physics_cache").get_to(v.physics_cache);
+    }
     j.at("seed").get_to(v.seed);
     j.at("max_num_tracks").get_to(v.max_num_tracks);
     j.at("max_steps").get_to(v.max_steps);
     j.at("storage_factor").get_to(v.storage_factor);
     j.at("secondary_stack_factor").get_to(v.secondary_stack_factor);
     j.at("use_device").get_to(v.use_device);
+    if (j.count("sort_tracks"))
+    {
+        j.at("sort_tracks").get_to(v.sort_tracks);
+    }
+    if (j.count("time_stages"))
+    {
+        j.at("time_stages").get_to(v.time_stages);
+    }
+    if (j.count("compact_tracks"))
+    {
+        j.at("compact_tracks").get_to(v.compact_tracks);
+    }
+    if (j.count("max_batch_primaries"))
+    {
+        j.at("max_batch_primaries").get_to(v.max_batch_primaries);
+    }
+    if (j.count("total_xs_table"))
+    {
+        j.at("total_xs_table").get_to(v.total_xs_table);
+    }
+    if (j.count("element_cdf"))
+    {
+        j.at("element_cdf").get_to(v.element_cdf);
+    }
+    if (j.count("pe_macro_xs_table"))
+    {
+        j.at("pe_macro_xs_table").get_to(v.pe_macro_xs_table);
+    }
 }
 
 //---------------------------------------------------------------------------//
@@ -118,20 +161,33 @@ TransporterInput load_input(const LDemoArgs& args)
         input.particles = result.particles;
         input.materials = result.materials;
 
+        input.options.total_xs_table = args.total_xs_table;
+        input.cache_file             = args.physics_cache;
+
         BremsstrahlungProcess::Options brem_options;
         brem_options.combined_model = args.combined_brem;
         brem_options.enable_lpm     = args.enable_lpm;
+        brem_options.element_cdf    = args.element_cdf;
 
         auto process_data
             = std::make_shared<ImportedProcesses>(std::move(data.processes));
+        input.cutoffs  = result.cutoffs;
+        input.imported = process_data;
         input.processes.push_back(
             std::make_shared<ComptonProcess>(result.particles, process_data));
-        input.processes.push_back(std::make_shared<PhotoelectricProcess>(
-            result.particles, result.materials, process_data));
+        input.processes.push_back(
+            std::make_shared<PhotoelectricProcess>(result.particles,
+                                                   result.materials,
+                                                   process_data,
+                                                   args.element_cdf,
+                                                   args.pe_macro_xs_table));
         input.processes.push_back(std::make_shared<RayleighProcess>(
             result.particles, result.materials, process_data));
-        input.processes.push_back(std::make_shared<GammaConversionProcess>(
-            result.particles, process_data));
+        input.processes.push_back(
+            std::make_shared<GammaConversionProcess>(result.particles,
+                                                     result.materials,
+                                                     process_data,
+                                                     args.element_cdf));
         input.processes.push_back(
             std::make_shared<EPlusAnnihilationProcess>(result.particles));
         input.processes.push_back(std::make_shared<EIonizationProcess>(
@@ -151,6 +207,9 @@ TransporterInput load_input(const LDemoArgs& args)
     result.max_num_tracks         = args.max_num_tracks;
     result.max_steps              = args.max_steps;
     result.secondary_stack_factor = args.secondary_stack_factor;
+    result.sort_tracks            = args.sort_tracks;
+    result.time_stages            = args.time_stages;
+    result.compact_tracks         = args.compact_tracks;
 
     CELER_ENSURE(result);
     return result;
@@ -158,17 +217,79 @@ TransporterInput load_input(const LDemoArgs& args)
 
 //---------------------------------------------------------------------------//
 /*!
- * Load primary particles from the demo input arguments.
+ * Create a reader for this process's primaries from the HepMC3 event file.
+ *
+ * Each call reads whole events until the number of primaries would exceed \c
+ * max_batch_primaries (or all remaining events if it is zero). When running
+ * with multiple processes, the events are distributed round-robin and only
+ * the primaries from this process's events are returned, so each batch holds
+ * roughly a fraction of the limit. Every process reads the entire event file.
+ * An empty result means all events have been read.
  */
-std::shared_ptr<celeritas::TrackInitParams>
-load_primaries(const std::shared_ptr<const celeritas::ParticleParams>& particles,
-               const LDemoArgs&                                        args)
+TransporterBase::ReadPrimaries
+make_primary_reader(const std::shared_ptr<const ParticleParams>& particles,
+                    const LDemoArgs&                             args,
+                    const Communicator&                          comm)
 {
     CELER_EXPECT(particles);
-    EventReader read_all_events(args.hepmc3_filename.c_str(), particles);
+
+    auto read_events = std::make_shared<EventReader>(
+        args.hepmc3_filename.c_str(), particles);
+    auto max_events    = std::numeric_limits<size_type>::max();
+    auto max_primaries = args.max_batch_primaries > 0
+                             ? args.max_batch_primaries
+                             : std::numeric_limits<size_type>::max();
+    auto size          = static_cast<EventId::size_type>(comm.size());
+    auto rank          = static_cast<EventId::size_type>(comm.rank());
+
+    return [read_events, max_events, max_primaries, size, rank] {
+        while (true)
+        {
+            auto primaries = (*read_events)(max_events, max_primaries);
+            if (primaries.empty())
+            {
+                // All events have been read
+                return primaries;
+            }
+
+            // Keep only the primaries from this process's events
+            auto iter = std::remove_if(
+                primaries.begin(),
+                primaries.end(),
+                [size, rank](const Primary& p) {
+                    return p.event_id.get() % size != rank;
+                });
+            primaries.erase(iter, primaries.end());
+            if (!primaries.empty())
+            {
+                return primaries;
+            }
+        }
+    };
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * Load the first batch of this process's primary particles.
+ *
+ * The result is null if no events were assigned to this process, which
+ * happens when there are more processes than events. The process must still
+ * take part in the collective reduction of the results.
+ */
+std::shared_ptr<TrackInitParams>
+load_primaries(const TransporterBase::ReadPrimaries& read_primaries,
+               const LDemoArgs&                      args)
+{
+    CELER_EXPECT(read_primaries);
+
     TrackInitParams::Input input;
-    input.primaries      = read_all_events();
+    input.primaries      = read_primaries();
     input.storage_factor = args.storage_factor;
+    if (input.primaries.empty())
+    {
+        CELER_LOG_LOCAL(warning) << "No events were assigned to this process";
+        return nullptr;
+    }
     return std::make_shared<TrackInitParams>(std::move(input));
 }
 
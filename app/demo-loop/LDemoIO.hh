@@ -16,6 +16,7 @@
 
 namespace celeritas
 {
+class Communicator;
 class ParticleParams;
 }
 
@@ -34,6 +35,7 @@ struct LDemoArgs
     std::string geometry_filename; //!< Path to GDML file
     std::string physics_filename;  //!< Path to ROOT exported Geant4 data
     std::string hepmc3_filename;   //!< Path to Hepmc3 event data
+    std::string physics_cache;     //!< Optional path to physics table cache
 
     // Control
     unsigned int seed{};
@@ -42,10 +44,17 @@ struct LDemoArgs
     size_type    storage_factor{};
     real_type    secondary_stack_factor{};
     bool         use_device{};
+    bool         sort_tracks{};
+    bool         time_stages{};
+    bool         compact_tracks{};
+    size_type    max_batch_primaries{}; //!< Read events in batches if nonzero
 
     // Options for physics processes and models
     bool combined_brem{true};
     bool enable_lpm{true};
+    bool total_xs_table{false};
+    bool element_cdf{false};
+    bool pe_macro_xs_table{false};
 
     //! Whether the run arguments are valid
     explicit operator bool() const
@@ -59,11 +68,17 @@ struct LDemoArgs
 
 // Load params from input arguments
 celeritas::TransporterInput load_input(const LDemoArgs& args);
-std::shared_ptr<celeritas::TrackInitParams>
 
-// Load primary particles from an input HepMC3 event file
-load_primaries(const std::shared_ptr<const celeritas::ParticleParams>& particles,
-               const LDemoArgs&                                        args);
+// Create a reader for this process's primaries from the HepMC3 event file
+celeritas::TransporterBase::ReadPrimaries make_primary_reader(
+    const std::shared_ptr<const celeritas::ParticleParams>& particles,
+    const LDemoArgs&                                        args,
+    const celeritas::Communicator&                          comm);
+
+// Load the first batch of this process's primary particles (null if none)
+std::shared_ptr<celeritas::TrackInitParams>
+load_primaries(const celeritas::TransporterBase::ReadPrimaries& read_primaries,
+               const LDemoArgs&                                 args);
 
 // Build transporter from input arguments
 std::unique_ptr<celeritas::TransporterBase>
@@ -87,7 +87,7 @@ CELER_FUNCTION void PreStepLauncher<M>::operator()(ThreadId tid) const
                                      particle.particle_id(),
                                      geo_mat.material_id(geo.volume_id()),
                                      tid);
-    celeritas::RngEngine         rng(states_.rng, ThreadId(tid));
+    celeritas::RngEngine         rng(params_.rng, states_.rng, ThreadId(tid));
 
     // Sample mfp and calculate minimum step (interaction or step-limited)
     demo_loop::calc_step_limits(
@@ -126,7 +126,7 @@ CELER_FUNCTION void AlongAndPostStepLauncher<M>::operator()(ThreadId tid) const
                                      geo_mat.material_id(geo.volume_id()),
                                      tid);
     celeritas::CutoffView        cutoffs(params_.cutoffs, mat.material_id());
-    celeritas::RngEngine         rng(states_.rng, ThreadId(tid));
+    celeritas::RngEngine         rng(params_.rng, states_.rng, ThreadId(tid));
 
     // Propagate, calculate energy loss, and select model
     demo_loop::move_and_select_model(cutoffs,
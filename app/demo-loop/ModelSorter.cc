@@ -0,0 +1,58 @@
+//----------------------------------*-C++-*----------------------------------//
+// Copyright 2021 UT-Battelle, LLC, and other Celeritas developers.
+// See the top-level COPYRIGHT file for details.
+// SPDX-License-Identifier: (Apache-2.0 OR MIT)
+//---------------------------------------------------------------------------//
+//! \file ModelSorter.cc
+//---------------------------------------------------------------------------//
+#include "ModelSorter.hh"
+
+#include <algorithm>
+#include <numeric>
+#include "base/Range.hh"
+
+using namespace celeritas;
+
+namespace demo_loop
+{
+//---------------------------------------------------------------------------//
+/*!
+ * Sort track slots by selected model on the host.
+ *
+ * Since the number of models is small, this uses a stable counting sort.
+ */
+void sort_by_model(
+    const PhysicsStateData<Ownership::reference, MemSpace::host>& physics,
+    const ModelSortRefs<MemSpace::host>&                          refs)
+{
+    CELER_EXPECT(physics.size() == refs.thread_ids.size());
+    CELER_EXPECT(refs.keys.size() == refs.thread_ids.size());
+    CELER_EXPECT(refs.offsets.size() >= 2);
+    CELER_EXPECT(refs.positions.size() + 1 == refs.offsets.size());
+
+    ModelSortKey calc_key{refs.offsets.size() - 2};
+    auto         offsets = refs.offsets[AllItems<size_type>{}];
+
+    // Histogram the number of tracks per model
+    std::fill(offsets.begin(), offsets.end(), size_type(0));
+    for (auto tid : range(ThreadId{physics.size()}))
+    {
+        size_type key  = calc_key(physics.state[tid]);
+        refs.keys[tid] = key;
+        ++offsets[key + 1];
+    }
+
+    // Convert counts to starting offsets
+    std::partial_sum(offsets.begin(), offsets.end(), offsets.begin());
+
+    // Scatter the track slots into their model's range
+    auto pos = refs.positions[AllItems<size_type>{}];
+    std::copy(offsets.begin(), offsets.end() - 1, pos.begin());
+    for (auto tid : range(ThreadId{physics.size()}))
+    {
+        refs.thread_ids[ThreadId{pos[refs.keys[tid]]++}] = tid;
+    }
+}
+
+//---------------------------------------------------------------------------//
+} // namespace demo_loop
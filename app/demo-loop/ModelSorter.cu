@@ -0,0 +1,83 @@
+//---------------------------------*-CUDA-*----------------------------------//
+// Copyright 2021 UT-Battelle, LLC, and other Celeritas developers.
+// See the top-level COPYRIGHT file for details.
+// SPDX-License-Identifier: (Apache-2.0 OR MIT)
+//---------------------------------------------------------------------------//
+//! \file ModelSorter.cu
+//---------------------------------------------------------------------------//
+#include "ModelSorter.hh"
+
+#include <thrust/binary_search.h>
+#include <thrust/device_ptr.h>
+#include <thrust/iterator/counting_iterator.h>
+#include <thrust/sort.h>
+#include <thrust/transform.h>
+
+using namespace celeritas;
+
+namespace demo_loop
+{
+namespace
+{
+//---------------------------------------------------------------------------//
+//! Convert an index to a thread ID
+struct MakeThreadId
+{
+    CELER_FUNCTION ThreadId operator()(size_type i) const
+    {
+        return ThreadId{i};
+    }
+};
+} // namespace
+
+//---------------------------------------------------------------------------//
+// KERNEL INTERFACES
+//---------------------------------------------------------------------------//
+/*!
+ * Sort track slots by selected model on device.
+ *
+ * The keys are sorted along with the thread IDs, and the offset of each
+ * model's range is found with a vectorized binary search.
+ */
+void sort_by_model(
+    const PhysicsStateData<Ownership::reference, MemSpace::device>& physics,
+    const ModelSortRefs<MemSpace::device>&                          refs)
+{
+    CELER_EXPECT(physics.size() == refs.thread_ids.size());
+    CELER_EXPECT(refs.keys.size() == refs.thread_ids.size());
+    CELER_EXPECT(refs.offsets.size() >= 2);
+
+    auto states  = physics.state[AllItems<PhysicsTrackState>{}].data();
+    auto keys    = thrust::device_pointer_cast(
+        refs.keys[AllItems<size_type>{}].data());
+    auto tids    = thrust::device_pointer_cast(
+        refs.thread_ids[AllItems<ThreadId>{}].data());
+    auto offsets = thrust::device_pointer_cast(
+        refs.offsets[AllItems<size_type>{}].data());
+    size_type size = physics.size();
+
+    // Calculate sort keys and initialize track slots to [0, size)
+    thrust::transform(thrust::device_pointer_cast(states),
+                      thrust::device_pointer_cast(states) + size,
+                      keys,
+                      ModelSortKey{refs.offsets.size() - 2});
+    thrust::transform(thrust::counting_iterator<size_type>(0),
+                      thrust::counting_iterator<size_type>(size),
+                      tids,
+                      MakeThreadId{});
+
+    // Group track slots by model, preserving the slot order within a model
+    thrust::stable_sort_by_key(keys, keys + size, tids);
+
+    // Find the start of each model's range (and the end offset)
+    thrust::lower_bound(
+        keys,
+        keys + size,
+        thrust::counting_iterator<size_type>(0),
+        thrust::counting_iterator<size_type>(refs.offsets.size()),
+        offsets);
+    CELER_CUDA_CHECK_ERROR();
+}
+
+//---------------------------------------------------------------------------//
+} // namespace demo_loop
@@ -0,0 +1,129 @@
+//----------------------------------*-C++-*----------------------------------//
+// Copyright 2021 UT-Battelle, LLC, and other Celeritas developers.
+// See the top-level COPYRIGHT file for details.
+// SPDX-License-Identifier: (Apache-2.0 OR MIT)
+//---------------------------------------------------------------------------//
+//! \file ModelSorter.hh
+//---------------------------------------------------------------------------//
+#pragma once
+
+#include "celeritas_config.h"
+#include "base/Assert.hh"
+#include "base/Collection.hh"
+#include "base/Macros.hh"
+#include "base/Span.hh"
+#include "base/Types.hh"
+#include "physics/base/PhysicsData.hh"
+#include "sim/TrackData.hh"
+
+using celeritas::MemSpace;
+using celeritas::Ownership;
+
+namespace demo_loop
+{
+//---------------------------------------------------------------------------//
+/*!
+ * Group track slots by the model selected for a discrete interaction.
+ *
+ * After the along-step/post-step kernel, each track that will undergo a
+ * discrete interaction has a valid model ID. This stage (stably) sorts the
+ * track slots by model ID so that each interaction kernel can be launched on
+ * only the contiguous range of tracks that selected it, rather than on every
+ * slot of the state vector. Tracks that are inactive or not interacting are
+ * sorted to the end.
+ */
+template<MemSpace M>
+class ModelSorter
+{
+  public:
+    //!@{
+    //! Type aliases
+    using size_type         = celeritas::size_type;
+    using ModelId           = celeritas::ModelId;
+    using ThreadId          = celeritas::ThreadId;
+    using SpanConstThreadId = celeritas::Span<const ThreadId>;
+    using StateDataRef      = celeritas::StateData<Ownership::reference, M>;
+    //!@}
+
+  public:
+    // Construct with the number of models and maximum number of tracks
+    ModelSorter(size_type num_models, size_type num_tracks);
+
+    // Sort the track slots by selected model
+    void operator()(const StateDataRef& states);
+
+    // Track slots that selected the given model
+    SpanConstThreadId thread_ids(ModelId model) const;
+
+  private:
+    template<class T>
+    using StateItems = celeritas::StateCollection<T, Ownership::value, M>;
+    template<class T>
+    using Items = celeritas::Collection<T, Ownership::value, M>;
+    using HostItems
+        = celeritas::Collection<size_type, Ownership::value, MemSpace::host>;
+
+    size_type             num_models_;
+    StateItems<ThreadId>  thread_ids_;
+    StateItems<size_type> keys_;
+    Items<size_type>      offsets_;
+    Items<size_type>      positions_;
+    HostItems             host_offsets_;
+};
+
+//---------------------------------------------------------------------------//
+/*!
+ * Sort key for a track: the selected model ID, or the number of models if the
+ * track is not undergoing a discrete interaction.
+ */
+struct ModelSortKey
+{
+    using size_type = celeritas::size_type;
+
+    size_type num_models;
+
+    CELER_FUNCTION size_type
+    operator()(const celeritas::PhysicsTrackState& state) const
+    {
+        return state.model_id ? state.model_id.unchecked_get() : num_models;
+    }
+};
+
+//---------------------------------------------------------------------------//
+// KERNEL LAUNCHER(S)
+//---------------------------------------------------------------------------//
+template<MemSpace M>
+struct ModelSortRefs
+{
+    template<class T>
+    using StateItems = celeritas::StateCollection<T, Ownership::reference, M>;
+    template<class T>
+    using Items = celeritas::Collection<T, Ownership::reference, M>;
+
+    StateItems<celeritas::ThreadId>  thread_ids;
+    StateItems<celeritas::size_type> keys;
+    Items<celeritas::size_type>      offsets;   //!< Size is num_models + 2
+    Items<celeritas::size_type>      positions; //!< Host only: num_models + 1
+};
+
+void sort_by_model(
+    const celeritas::PhysicsStateData<Ownership::reference, MemSpace::host>&,
+    const ModelSortRefs<MemSpace::host>&);
+
+void sort_by_model(
+    const celeritas::PhysicsStateData<Ownership::reference, MemSpace::device>&,
+    const ModelSortRefs<MemSpace::device>&);
+
+#if !CELERITAS_USE_CUDA
+inline void sort_by_model(
+    const celeritas::PhysicsStateData<Ownership::reference, MemSpace::device>&,
+    const ModelSortRefs<MemSpace::device>&)
+{
+    CELER_NOT_CONFIGURED("CUDA");
+}
+#endif
+
+//---------------------------------------------------------------------------//
+} // namespace demo_loop
+
+#include "ModelSorter.i.hh"
@@ -0,0 +1,81 @@
+//----------------------------------*-C++-*----------------------------------//
+// Copyright 2021 UT-Battelle, LLC, and other Celeritas developers.
+// See the top-level COPYRIGHT file for details.
+// SPDX-License-Identifier: (Apache-2.0 OR MIT)
+//---------------------------------------------------------------------------//
+//! \file ModelSorter.i.hh
+//---------------------------------------------------------------------------//
+
+#include "base/CollectionBuilder.hh"
+
+namespace demo_loop
+{
+//---------------------------------------------------------------------------//
+/*!
+ * Construct with the number of models and maximum number of tracks.
+ */
+template<MemSpace M>
+ModelSorter<M>::ModelSorter(size_type num_models, size_type num_tracks)
+    : num_models_(num_models)
+{
+    CELER_EXPECT(num_models_ > 0);
+    CELER_EXPECT(num_tracks > 0);
+
+    resize(&thread_ids_, num_tracks);
+    resize(&keys_, num_tracks);
+    // One extra bin for non-interacting tracks, plus the end offset
+    resize(&offsets_, num_models_ + 2);
+    if (M == MemSpace::host)
+    {
+        // Insertion point for each bin during the counting sort
+        resize(&positions_, num_models_ + 1);
+    }
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * Sort the track slots by selected model.
+ *
+ * This must be called after the post-step kernel (which selects the model)
+ * and before the interaction kernels are launched.
+ */
+template<MemSpace M>
+void ModelSorter<M>::operator()(const StateDataRef& states)
+{
+    CELER_EXPECT(states.size() == thread_ids_.size());
+
+    ModelSortRefs<M> refs;
+    refs.thread_ids = thread_ids_;
+    refs.keys       = keys_;
+    refs.offsets    = offsets_;
+    refs.positions  = positions_;
+    sort_by_model(states.physics, refs);
+
+    // Copy the (small) array of offsets back to the host
+    host_offsets_ = offsets_;
+    CELER_ENSURE(host_offsets_.size() == num_models_ + 2);
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * Track slots that selected the given model.
+ *
+ * The result is a span in the sorter's memory space, suitable for assigning
+ * to \c ModelInteractRef::thread_ids .
+ */
+template<MemSpace M>
+auto ModelSorter<M>::thread_ids(ModelId model) const -> SpanConstThreadId
+{
+    CELER_EXPECT(model < num_models_);
+    CELER_EXPECT(!host_offsets_.empty());
+
+    using OffsetId  = celeritas::ItemId<size_type>;
+    size_type start = host_offsets_[OffsetId{model.get()}];
+    size_type stop  = host_offsets_[OffsetId{model.get() + 1}];
+    CELER_ASSERT(start <= stop && stop <= thread_ids_.size());
+    return thread_ids_[celeritas::AllItems<ThreadId, M>{}].subspan(
+        start, stop - start);
+}
+
+//---------------------------------------------------------------------------//
+} // namespace demo_loop
@@ -0,0 +1,196 @@
+//----------------------------------*-C++-*----------------------------------//
+// Copyright 2021 UT-Battelle, LLC, and other Celeritas developers.
+// See the top-level COPYRIGHT file for details.
+// SPDX-License-Identifier: (Apache-2.0 OR MIT)
+//---------------------------------------------------------------------------//
+//! \file ReduceResult.cc
+//---------------------------------------------------------------------------//
+#include "ReduceResult.hh"
+
+#include <algorithm>
+#include <string>
+#include <vector>
+#include "base/Range.hh"
+#include "comm/Communicator.hh"
+#include "comm/Operations.hh"
+#include "physics/base/ParticleParams.hh"
+#include "physics/base/PhysicsParams.hh"
+
+using namespace celeritas;
+
+namespace demo_loop
+{
+namespace
+{
+//---------------------------------------------------------------------------//
+// HELPER FUNCTIONS
+//---------------------------------------------------------------------------//
+using VecString = std::vector<std::string>;
+
+//---------------------------------------------------------------------------//
+/*!
+ * Reduce vectors whose length may differ across processes.
+ *
+ * Shorter vectors (e.g. the per-step results from a process that finished in
+ * fewer steps) are padded with zeros.
+ */
+template<class T>
+void allreduce_padded(const Communicator& comm,
+                      Operation           op,
+                      std::vector<T>*     data)
+{
+    auto size = allreduce(
+        comm, Operation::max, static_cast<size_type>(data->size()));
+    data->resize(size);
+    allreduce(comm, op, make_span(*data));
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * All possible labels for the particle/process interaction counts.
+ *
+ * This must match the labels constructed by the particle process diagnostic.
+ */
+VecString process_labels(const TransporterInput& input)
+{
+    VecString result;
+    for (auto model_id : range(ModelId{input.physics->num_models()}))
+    {
+        const auto& process
+            = input.physics->process(input.physics->process_id(model_id));
+        for (auto particle_id : range(ParticleId{input.particles->size()}))
+        {
+            result.push_back(process.label() + " "
+                             + input.particles->id_to_label(particle_id));
+        }
+    }
+    std::sort(result.begin(), result.end());
+    result.erase(std::unique(result.begin(), result.end()), result.end());
+    return result;
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * All particle labels for the step distributions.
+ */
+VecString particle_labels(const TransporterInput& input)
+{
+    VecString result;
+    for (auto particle_id : range(ParticleId{input.particles->size()}))
+    {
+        result.push_back(input.particles->id_to_label(particle_id));
+    }
+    return result;
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * Sum sparse counts over all processes.
+ *
+ * Since each process only stores the nonzero counts, they're scattered into a
+ * dense array indexed by the known list of labels before reducing.
+ */
+void sum_counts(const Communicator&                 comm,
+                const VecString&                    labels,
+                TransporterResult::MapStringCount* counts)
+{
+    std::vector<size_type> dense(labels.size(), 0);
+    for (auto i : range(labels.size()))
+    {
+        auto iter = counts->find(labels[i]);
+        if (iter != counts->end())
+        {
+            dense[i] = iter->second;
+        }
+    }
+    allreduce(comm, Operation::sum, make_span(dense));
+
+    counts->clear();
+    for (auto i : range(labels.size()))
+    {
+        if (dense[i] > 0)
+        {
+            (*counts)[labels[i]] = dense[i];
+        }
+    }
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * Sum sparse histograms over all processes.
+ */
+void sum_histograms(const Communicator&                    comm,
+                    const VecString&                       labels,
+                    TransporterResult::MapStringVecCount* hists)
+{
+    // Get the number of bins (all nonempty histograms have the same size)
+    size_type num_bins = 0;
+    for (const auto& kv : *hists)
+    {
+        num_bins = std::max<size_type>(num_bins, kv.second.size());
+    }
+    num_bins = allreduce(comm, Operation::max, num_bins);
+
+    std::vector<size_type> dense(labels.size() * num_bins, 0);
+    for (auto i : range(labels.size()))
+    {
+        auto iter = hists->find(labels[i]);
+        if (iter != hists->end())
+        {
+            CELER_ASSERT(iter->second.size() == num_bins);
+            std::copy(iter->second.begin(),
+                      iter->second.end(),
+                      dense.begin() + i * num_bins);
+        }
+    }
+    allreduce(comm, Operation::sum, make_span(dense));
+
+    hists->clear();
+    for (auto i : range(labels.size()))
+    {
+        auto start = dense.begin() + i * num_bins;
+        auto stop  = start + num_bins;
+        if (std::any_of(start, stop, [](size_type x) { return x > 0; }))
+        {
+            (*hists)[labels[i]] = {start, stop};
+        }
+    }
+}
+
+//---------------------------------------------------------------------------//
+} // namespace
+
+//---------------------------------------------------------------------------//
+/*!
+ * Combine the transport results from all processes.
+ *
+ * Each process transports a distinct subset of the events, so the tallies
+ * (energy deposition, living tracks per step, interaction counts, and step
+ * distributions) are summed. The per-step and total wall-clock times are
+ * the maximum over all processes. The optional per-stage timings are not
+ * reduced and remain those of the local process.
+ *
+ * This is a collective operation: the combined result is available on all
+ * processes.
+ */
+void reduce_result(const Communicator&     comm,
+                   const TransporterInput& input,
+                   TransporterResult*      result)
+{
+    CELER_EXPECT(input);
+    CELER_EXPECT(result);
+
+    if (comm.size() <= 1)
+        return;
+
+    allreduce_padded(comm, Operation::max, &result->time);
+    allreduce_padded(comm, Operation::sum, &result->alive);
+    allreduce_padded(comm, Operation::sum, &result->edep);
+    sum_counts(comm, process_labels(input), &result->process);
+    sum_histograms(comm, particle_labels(input), &result->steps);
+    result->total_time
+        = allreduce(comm, Operation::max, result->total_time);
+}
+
+//---------------------------------------------------------------------------//
+} // namespace demo_loop
@@ -0,0 +1,26 @@
+//----------------------------------*-C++-*----------------------------------//
+// Copyright 2021 UT-Battelle, LLC, and other Celeritas developers.
+// See the top-level COPYRIGHT file for details.
+// SPDX-License-Identifier: (Apache-2.0 OR MIT)
+//---------------------------------------------------------------------------//
+//! \file ReduceResult.hh
+//---------------------------------------------------------------------------//
+#pragma once
+
+#include "Transporter.hh"
+
+namespace celeritas
+{
+class Communicator;
+}
+
+namespace demo_loop
+{
+//---------------------------------------------------------------------------//
+// Combine the transport results from all processes
+void reduce_result(const celeritas::Communicator&     comm,
+                   const celeritas::TransporterInput& input,
+                   celeritas::TransporterResult*      result);
+
+//---------------------------------------------------------------------------//
+} // namespace demo_loop
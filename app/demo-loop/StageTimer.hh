@@ -0,0 +1,165 @@
+//----------------------------------*-C++-*----------------------------------//
+// Copyright 2021 UT-Battelle, LLC, and other Celeritas developers.
+// See the top-level COPYRIGHT file for details.
+// SPDX-License-Identifier: (Apache-2.0 OR MIT)
+//---------------------------------------------------------------------------//
+//! \file StageTimer.hh
+//---------------------------------------------------------------------------//
+#pragma once
+
+#include <string>
+#include <unordered_map>
+#include <vector>
+#include "base/Assert.hh"
+#include "base/Stopwatch.hh"
+#include "base/Types.hh"
+#include "comm/Device.hh"
+
+namespace demo_loop
+{
+//---------------------------------------------------------------------------//
+/*!
+ * Accumulate the wall-clock time spent in each stage of a transport step.
+ *
+ * Each call marks the end of the named stage, which is charged the time
+ * elapsed since the previous mark (or the start of the step). A stage may be
+ * marked at most once per step, and stages that are skipped in a step are
+ * assigned zero time.
+ *
+ * When disabled, marking a stage is a no-op so that only the per-step time is
+ * collected by the caller. When enabled for device transport, the device is
+ * synchronized at every mark so that asynchronous kernels are charged to the
+ * stage that launched them: this can add significant overhead.
+ *
+ * \code
+    StageTimer time_stage(enable, MemSpace::device);
+    while (...)
+    {
+        pre_step(...);
+        time_stage("pre_step");
+        along_and_post_step(...);
+        time_stage("along_and_post_step");
+        time_stage.end_step();
+    }
+   \endcode
+ */
+class StageTimer
+{
+  public:
+    //!@{
+    //! Type aliases
+    using real_type        = celeritas::real_type;
+    using size_type        = celeritas::size_type;
+    using VecReal          = std::vector<real_type>;
+    using MapStringReal    = std::unordered_map<std::string, real_type>;
+    using MapStringVecReal = std::unordered_map<std::string, VecReal>;
+    //!@}
+
+  public:
+    // Construct with whether timing is enabled and the memory space
+    inline StageTimer(bool enabled, celeritas::MemSpace m);
+
+    //! Whether stages are being timed
+    bool enabled() const { return enabled_; }
+
+    // Charge the time since the last mark to the given stage
+    inline void operator()(const std::string& stage);
+
+    // Mark the beginning of a new step
+    inline void end_step();
+
+    // Per-step time for each stage
+    inline MapStringVecReal stage_times() const;
+
+    // Total time for each stage
+    inline MapStringReal total_stage_times() const;
+
+  private:
+    bool                 enabled_;
+    bool                 sync_;
+    size_type            step_{0};
+    MapStringVecReal     times_;
+    celeritas::Stopwatch get_time_;
+};
+
+//---------------------------------------------------------------------------//
+// INLINE DEFINITIONS
+//---------------------------------------------------------------------------//
+/*!
+ * Construct with whether timing is enabled and the memory space.
+ */
+StageTimer::StageTimer(bool enabled, celeritas::MemSpace m)
+    : enabled_(enabled), sync_(enabled && m == celeritas::MemSpace::device)
+{
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * Charge the time since the last mark to the given stage.
+ */
+void StageTimer::operator()(const std::string& stage)
+{
+    if (!enabled_)
+        return;
+
+    if (sync_)
+    {
+        celeritas::device_synchronize();
+    }
+
+    VecReal& times = times_[stage];
+    CELER_EXPECT(times.size() <= step_);
+    times.resize(step_ + 1);
+    times[step_] = get_time_();
+    get_time_    = {};
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * Mark the beginning of a new step.
+ */
+void StageTimer::end_step()
+{
+    if (!enabled_)
+        return;
+
+    ++step_;
+    get_time_ = {};
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * Per-step time for each stage, indexed by step number.
+ */
+auto StageTimer::stage_times() const -> MapStringVecReal
+{
+    MapStringVecReal result = times_;
+    for (auto& kv : result)
+    {
+        // Pad stages that were not reached in the final steps
+        kv.second.resize(step_);
+    }
+    return result;
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * Total time for each stage, summed over all steps.
+ */
+auto StageTimer::total_stage_times() const -> MapStringReal
+{
+    MapStringReal result;
+    for (const auto& kv : times_)
+    {
+        real_type total = 0;
+        for (real_type t : kv.second)
+        {
+            total += t;
+        }
+        result[kv.first] = total;
+    }
+    return result;
+}
+
+//---------------------------------------------------------------------------//
+} // namespace demo_loop
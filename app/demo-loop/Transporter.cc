@@ -7,7 +7,10 @@
 //---------------------------------------------------------------------------//
 #include "Transporter.hh"
 
+#include <future>
+#include "base/Stopwatch.hh"
 #include "base/VectorUtils.hh"
+#include "comm/Device.hh"
 #include "geometry/GeoMaterialParams.hh"
 #include "geometry/GeoParams.hh"
 #include "physics/base/CutoffParams.hh"
@@ -30,6 +33,8 @@
 #include "generated/PreStepKernel.hh"
 #include "generated/ProcessInteractionsKernel.hh"
 #include "LDemoLauncher.hh"
+#include "ModelSorter.hh"
+#include "StageTimer.hh"
 
 using namespace demo_loop;
 
@@ -104,12 +109,19 @@ struct ParamsShim
 /*!
  * Launch interaction kernels for all applicable models.
  *
- * For now, just launch *all* the models.
+ * Without a sorter, *all* the models are launched over all track slots. If
+ * the track slots have been sorted by model, each kernel is launched only on
+ * the tracks that selected it, and models with no interacting tracks are
+ * skipped entirely.
+ *
+ * If stage timing is enabled, each model's kernel is timed separately.
  */
 template<MemSpace M>
 void launch_models(TransporterInput const& host_params,
                    ParamsData<Ownership::const_reference, M> const& params,
-                   StateData<Ownership::reference, M> const&        states)
+                   StateData<Ownership::reference, M> const&        states,
+                   ModelSorter<M> const*                            sorter,
+                   StageTimer&                                      time_stage)
 {
     // TODO: these *should* be able to be persistent across steps, rather than
     // recreated at every step.
@@ -119,6 +131,7 @@ void launch_models(TransporterInput const& host_params,
     refs.params.physics      = params.physics;
     refs.params.relaxation   = params.relaxation;
     refs.params.cutoffs      = params.cutoffs;
+    refs.params.rng          = params.rng;
     refs.states.particle     = states.particles;
     refs.states.material     = states.materials;
     refs.states.physics      = states.physics;
@@ -133,8 +146,19 @@ void launch_models(TransporterInput const& host_params,
     // Loop over physics models IDs and invoke `interact`
     for (auto model_id : range(ModelId{host_params.physics->num_models()}))
     {
+        if (sorter)
+        {
+            // Only visit the track slots that selected this model
+            refs.thread_ids = sorter->thread_ids(model_id);
+            if (refs.thread_ids.empty())
+                continue;
+        }
         const Model& model = host_params.physics->model(model_id);
         model.interact(refs);
+        if (time_stage.enabled())
+        {
+            time_stage("launch_models/" + model.label());
+        }
     }
 }
 
@@ -166,6 +190,31 @@ Transporter<M>::Transporter(TransporterInput inp) : input_(std::move(inp))
 template<MemSpace M>
 TransporterResult Transporter<M>::operator()(const TrackInitParams& primaries)
 {
+    return (*this)(primaries, nullptr);
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * Transport the input primaries and those read in later batches.
+ *
+ * The primaries in the track initializer params are transported first. If a
+ * reader is given, it is called on a separate thread to read the next batch
+ * of primaries while the current tracks are transported. The batch is
+ * retrieved once the previous primaries have all been moved into the track
+ * initializers and there are too few initializers left to fill the track
+ * vector, and then reading the following batch begins. Only two batches are
+ * held in host memory at once, so the memory use is bounded by the batch size
+ * rather than by the total number of events.
+ *
+ * The reader must return whole events whose IDs are distinct from all
+ * previous events.
+ */
+template<MemSpace M>
+TransporterResult Transporter<M>::operator()(const TrackInitParams& primaries,
+                                             ReadPrimaries read_more)
+{
+    Stopwatch get_transport_time;
+
     // Diagnostics
     // TODO: Create a vector of these objects.
     TrackDiagnostic<M> track_diagnostic;
@@ -175,48 +224,156 @@ TransporterResult Transporter<M>::operator()(const TrackInitParams& primaries)
         params_, input_.particles, input_.physics);
     EnergyDiagnostic<M> energy_diagnostic(linspace(-700.0, 700.0, 1024 + 1));
 
+    // Optional grouping of track slots by the selected model
+    std::unique_ptr<ModelSorter<M>> sort_by_model;
+    if (input_.sort_tracks)
+    {
+        sort_by_model = std::make_unique<ModelSorter<M>>(
+            input_.physics->num_models(), input_.max_num_tracks);
+    }
+
     // Copy primaries to device and create track initializers
     TrackInitStateData<Ownership::value, M> track_init_states;
     resize(&track_init_states, primaries.host_ref(), input_.max_num_tracks);
-    CELER_ASSERT(primaries.host_ref().primaries.size()
-                 <= track_init_states.initializers.capacity());
     extend_from_primaries(primaries.host_ref(), &track_init_states);
 
-    size_type num_alive       = 0;
-    size_type num_inits       = track_init_states.initializers.size();
+    // Start reading the next batch of primaries
+    VecPrimary              pending_primaries;
+    std::future<VecPrimary> next_batch;
+    if (read_more)
+    {
+        next_batch = std::async(std::launch::async, read_more);
+    }
+
+    // Host storage for track initializers that exceed the allocated capacity
+    std::vector<TrackInitializer> overflow_inits;
+
+    // Local reference to the state data, which tracks the active range
+    StateData<Ownership::reference, M> states = states_.ref();
+    if (input_.compact_tracks)
+    {
+        // Start from an empty active range so that tracks fill the front of
+        // the state vector
+        states.num_active = 0;
+        track_init_states.vacancies.resize(0);
+        compact_tracks(params_, &states, &track_init_states);
+    }
+
+    // Wall-clock time per step and (optionally) per stage
+    TransporterResult::VecReal step_times;
+    StageTimer                 time_stage(input_.time_stages, M);
+
+    size_type num_alive = 0;
+    size_type num_inits = track_init_states.initializers.size()
+                          + track_init_states.num_primaries;
     size_type remaining_steps = input_.max_steps;
 
-    while (num_alive > 0 || num_inits > 0)
+    while (num_alive > 0 || num_inits > 0 || next_batch.valid())
     {
+        Stopwatch get_step_time;
+
+        if (next_batch.valid() && pending_primaries.empty()
+            && track_init_states.num_primaries == 0
+            && track_init_states.initializers.size() < input_.max_num_tracks)
+        {
+            // Wait for the next batch and start reading the one after it
+            pending_primaries = next_batch.get();
+            if (!pending_primaries.empty())
+            {
+                extend_track_counters(make_span(pending_primaries),
+                                      &track_init_states);
+                next_batch = std::async(std::launch::async, read_more);
+            }
+        }
+
+        // Create track initializers from primaries that didn't fit before
+        if (track_init_states.num_primaries > 0)
+        {
+            extend_from_primaries(primaries.host_ref(), &track_init_states);
+        }
+        if (!pending_primaries.empty())
+        {
+            extend_from_primaries(&pending_primaries, &track_init_states);
+        }
+        time_stage("extend_from_primaries");
+
         // Create new tracks from primaries or secondaries
-        initialize_tracks(params_, states_.ref(), &track_init_states);
+        initialize_tracks(params_, states, &track_init_states);
+        if (input_.compact_tracks)
+        {
+            // New tracks were added after the dense range of live tracks
+            states.num_active = states.size()
+                                - track_init_states.vacancies.size();
+        }
+        time_stage("initialize_tracks");
+
+        generated::pre_step(params_, states);
+        time_stage("pre_step");
+        generated::along_and_post_step(params_, states);
+        time_stage("along_and_post_step");
 
-        generated::pre_step(params_, states_.ref());
-        generated::along_and_post_step(params_, states_.ref());
+        if (sort_by_model)
+        {
+            // Group the track slots by the model that was selected
+            (*sort_by_model)(states);
+            time_stage("sort_tracks");
+        }
 
         // Launch the interaction kernels for all applicable models
-        launch_models(input_, params_, states_.ref());
+        launch_models(input_,
+                      params_,
+                      states,
+                      sort_by_model.get(),
+                      time_stage);
 
         // Mid-step diagnostics
-        process_diagnostic.mid_step(states_.ref());
-        step_diagnostic.mid_step(states_.ref());
+        process_diagnostic.mid_step(states);
+        step_diagnostic.mid_step(states);
+        time_stage("mid_step_diagnostics");
 
         // Postprocess secondaries and interaction results
-        generated::process_interactions(params_, states_.ref());
+        generated::process_interactions(params_, states);
+        time_stage("process_interactions");
 
         // Create track initializers from surviving secondaries
-        extend_from_secondaries(params_, states_.ref(), &track_init_states);
+        extend_from_secondaries(
+            params_, states, &track_init_states, &overflow_inits);
+        time_stage("extend_from_secondaries");
+
+        // Bin the energy deposition before compaction moves live tracks out
+        // of the slots where they deposited it
+        energy_diagnostic.end_step(states);
+        time_stage("energy_diagnostic");
+
+        if (input_.compact_tracks)
+        {
+            // Move live tracks into the front of the state vector so the
+            // kernels in the next step only visit the active range
+            compact_tracks(params_, &states, &track_init_states);
+            time_stage("compact_tracks");
+        }
 
         // Clear secondaries
-        generated::cleanup(params_, states_.ref());
+        generated::cleanup(params_, states);
+        time_stage("cleanup");
 
         // Get the number of track initializers and active tracks
         num_alive = input_.max_num_tracks - track_init_states.vacancies.size();
-        num_inits = track_init_states.initializers.size();
+        num_inits = track_init_states.initializers.size()
+                    + overflow_inits.size() + track_init_states.num_primaries
+                    + pending_primaries.size();
 
         // End-of-step diagnostic(s)
-        track_diagnostic.end_step(states_.ref());
-        energy_diagnostic.end_step(states_.ref());
+        track_diagnostic.end_step(states);
+        time_stage("end_step_diagnostics");
+
+        time_stage.end_step();
+        if (M == MemSpace::device)
+        {
+            // Wait for the step's kernels before reading the step time
+            device_synchronize();
+        }
+        step_times.push_back(get_step_time());
 
         if (--remaining_steps == 0)
         {
@@ -227,12 +384,14 @@ TransporterResult Transporter<M>::operator()(const TrackInitParams& primaries)
 
     // Collect results from diagnostics
     TransporterResult result;
-    result.time       = {0};
-    result.alive      = track_diagnostic.num_alive_per_step();
-    result.edep       = energy_diagnostic.energy_deposition();
-    result.process    = process_diagnostic.particle_processes();
-    result.steps      = step_diagnostic.steps();
-    result.total_time = 0;
+    result.time             = std::move(step_times);
+    result.alive            = track_diagnostic.num_alive_per_step();
+    result.edep             = energy_diagnostic.energy_deposition();
+    result.process          = process_diagnostic.particle_processes();
+    result.steps            = step_diagnostic.steps();
+    result.stage_time       = time_stage.stage_times();
+    result.total_stage_time = time_stage.total_stage_times();
+    result.total_time       = get_transport_time();
     return result;
 }
 
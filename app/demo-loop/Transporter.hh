@@ -7,6 +7,7 @@
 //---------------------------------------------------------------------------//
 #pragma once
 
+#include <functional>
 #include <memory>
 #include <unordered_map>
 #include <utility>
@@ -15,6 +16,7 @@
 #include "base/Assert.hh"
 #include "base/CollectionStateStore.hh"
 #include "base/Types.hh"
+#include "physics/base/Primary.hh"
 #include "sim/TrackData.hh"
 
 namespace celeritas
@@ -53,6 +55,11 @@ struct TransporterInput
     size_type max_steps{};
     real_type secondary_stack_factor{};
 
+    // Options
+    bool sort_tracks{false};    //!< Launch interactions on sorted track slots
+    bool time_stages{false};    //!< Time each stage of the step (adds syncs)
+    bool compact_tracks{false}; //!< Keep live tracks in a dense prefix
+
     //! True if all params are assigned
     explicit operator bool() const
     {
@@ -70,7 +77,9 @@ struct TransporterResult
     using VecCount          = std::vector<size_type>;
     using VecReal           = std::vector<real_type>;
     using MapStringCount    = std::unordered_map<std::string, size_type>;
+    using MapStringReal     = std::unordered_map<std::string, real_type>;
     using MapStringVecCount = std::unordered_map<std::string, VecCount>;
+    using MapStringVecReal  = std::unordered_map<std::string, VecReal>;
     //!@}
 
     //// DATA ////
@@ -80,7 +89,9 @@ struct TransporterResult
     VecReal           edep;    //!< Energy deposition along the grid
     MapStringCount    process; //!< Count of particle/process interactions
     MapStringVecCount steps;   //!< Distribution of steps
-    double            total_time = 0; //!< Wall clock
+    MapStringVecReal  stage_time;       //!< Real time per stage per step
+    MapStringReal     total_stage_time; //!< Real time per stage
+    double            total_time = 0;   //!< Wall clock
 };
 
 //---------------------------------------------------------------------------//
@@ -95,12 +106,25 @@ struct TransporterResult
  */
 class TransporterBase
 {
+  public:
+    //!@{
+    //! Type aliases
+    using VecPrimary = std::vector<Primary>;
+    //! Read the next batch of primaries (empty when all have been read)
+    using ReadPrimaries = std::function<VecPrimary()>;
+    //!@}
+
   public:
     virtual ~TransporterBase() = 0;
 
     // Transport the input primaries and all secondaries produced
     virtual TransporterResult operator()(const TrackInitParams& primaries) = 0;
 
+    // Transport the input primaries and those read in later batches
+    virtual TransporterResult
+    operator()(const TrackInitParams& primaries, ReadPrimaries read_more)
+        = 0;
+
     //! Access input parameters (TODO hacky)
     virtual const TransporterInput& input() const = 0;
 };
@@ -119,6 +143,10 @@ class Transporter : public TransporterBase
     // Transport the input primaries and all secondaries produced
     TransporterResult operator()(const TrackInitParams& primaries) final;
 
+    // Transport the input primaries and those read in later batches
+    TransporterResult operator()(const TrackInitParams& primaries,
+                                 ReadPrimaries          read_more) final;
+
     //! Access input parameters (TODO hacky)
     const TransporterInput& input() const final { return input_; }
 
@@ -21,6 +21,8 @@ inline void to_json(nlohmann::json& j, const TransporterResult& v)
                        {"edep", v.edep},
                        {"process", v.process},
                        {"steps", v.steps},
+                       {"stage_time", v.stage_time},
+                       {"total_stage_time", v.total_stage_time},
                        {"total_time", v.total_time}};
 }
 
@@ -24,6 +24,7 @@
 #include "comm/ScopedMpiInit.hh"
 
 #include "LDemoIO.hh"
+#include "ReduceResult.hh"
 #include "Transporter.hh"
 #include "Transporter.json.hh"
 
@@ -38,8 +39,11 @@ namespace
 //---------------------------------------------------------------------------//
 /*!
  * Run, launch, and output.
+ *
+ * Each process transports a subset of the events, and the results are
+ * combined and written by the first process.
  */
-void run(std::istream& is)
+void run(std::istream& is, const celeritas::Communicator& comm)
 {
     using celeritas::TrackInitParams;
     using celeritas::TransporterResult;
@@ -60,8 +64,21 @@ void run(std::istream& is)
     auto transport_ptr = build_transporter(run_args);
 
     // Run all the primaries
-    auto primaries = load_primaries(transport_ptr->input().particles, run_args);
-    auto result    = (*transport_ptr)(*primaries);
+    auto read_primaries
+        = make_primary_reader(transport_ptr->input().particles, run_args, comm);
+    auto              primaries = load_primaries(read_primaries, run_args);
+    TransporterResult result;
+    if (primaries)
+    {
+        result = run_args.max_batch_primaries > 0
+                     ? (*transport_ptr)(*primaries, read_primaries)
+                     : (*transport_ptr)(*primaries);
+    }
+
+    // Combine results from all processes, including any without events
+    reduce_result(comm, transport_ptr->input(), &result);
+    if (comm.rank() != 0)
+        return;
 
     // Save output
     nlohmann::json outp = {
@@ -72,6 +89,7 @@ void run(std::istream& is)
             {
                 {"version", std::string(celeritas_version)},
                 {"device", celeritas::device()},
+                {"num_processes", comm.size()},
                 {"kernels", celeritas::kernel_diagnostics()},
             },
         },
@@ -96,12 +114,6 @@ int main(int argc, char* argv[])
                ? Communicator{}
                : Communicator::comm_world());
 
-    if (comm.size() > 1)
-    {
-        CELER_LOG(critical) << "TODO: this app cannot run in parallel";
-        return EXIT_FAILURE;
-    }
-
     // Process input arguments
     std::vector<std::string> args(argv, argv + argc);
     if (args.size() != 2 || args[1] == "--help" || args[1] == "-h")
@@ -118,6 +130,8 @@ int main(int argc, char* argv[])
     std::istream* instream = nullptr;
     if (filename == "-")
     {
+        // Note that MPI launchers usually forward stdin only to the first
+        // process, so multi-process runs need an input file
         instream = &std::cin;
         filename = "<stdin>"; // For nicer output on failure
     }
@@ -135,7 +149,7 @@ int main(int argc, char* argv[])
 
     try
     {
-        run(*instream);
+        run(*instream, comm);
     }
     catch (const std::exception& e)
     {
@@ -20,7 +20,7 @@ namespace demo_loop
 void bin_energy(const StateHostRef& states, PointersHost& pointers)
 {
     EnergyDiagnosticLauncher<MemSpace::host> launch(states, pointers);
-    for (auto tid : range(ThreadId{states.size()}))
+    for (auto tid : range(ThreadId{states.num_active}))
     {
         launch(tid);
     }
@@ -25,7 +25,7 @@ __global__ void
 bin_energy_kernel(const StateDeviceRef states, PointersDevice pointers)
 {
     auto tid = KernelParamCalculator::thread_id();
-    if (!(tid < states.size()))
+    if (!(tid < states.num_active))
         return;
 
     EnergyDiagnosticLauncher<MemSpace::device> launch(states, pointers);
@@ -39,7 +39,10 @@ void bin_energy(const StateDeviceRef& states, PointersDevice& pointers)
 {
     static const KernelParamCalculator calc_launch_params(bin_energy_kernel,
                                                           "bin_energy");
-    auto lparams = calc_launch_params(states.size());
+    if (states.num_active == 0)
+        return;
+
+    auto lparams = calc_launch_params(states.num_active);
     bin_energy_kernel<<<lparams.grid_size, lparams.block_size>>>(states,
                                                                  pointers);
     CELER_CUDA_CHECK_ERROR();
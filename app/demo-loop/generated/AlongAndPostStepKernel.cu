@@ -24,7 +24,7 @@ __global__ void along_and_post_step_kernel(
     StateDeviceRef const states)
 {
     auto tid = KernelParamCalculator::thread_id();
-    if (!(tid < states.size()))
+    if (!(tid < states.num_active))
         return;
 
     AlongAndPostStepLauncher<MemSpace::device> launch(params, states);
@@ -41,7 +41,7 @@ void along_and_post_step(
 
     static const KernelParamCalculator along_and_post_step_ckp(
         along_and_post_step_kernel, "along_and_post_step");
-    auto kp = along_and_post_step_ckp(states.size());
+    auto kp = along_and_post_step_ckp(states.num_active);
     along_and_post_step_kernel<<<kp.grid_size, kp.block_size>>>(
         params, states);
     CELER_CUDA_CHECK_ERROR();
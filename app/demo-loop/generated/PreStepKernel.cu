@@ -24,7 +24,7 @@ __global__ void pre_step_kernel(
     StateDeviceRef const states)
 {
     auto tid = KernelParamCalculator::thread_id();
-    if (!(tid < states.size()))
+    if (!(tid < states.num_active))
         return;
 
     PreStepLauncher<MemSpace::device> launch(params, states);
@@ -41,7 +41,7 @@ void pre_step(
 
     static const KernelParamCalculator pre_step_ckp(
         pre_step_kernel, "pre_step");
-    auto kp = pre_step_ckp(states.size());
+    auto kp = pre_step_ckp(states.num_active);
     pre_step_kernel<<<kp.grid_size, kp.block_size>>>(
         params, states);
     CELER_CUDA_CHECK_ERROR();
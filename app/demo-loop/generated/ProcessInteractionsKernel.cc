@@ -25,7 +25,7 @@ void process_interactions(
 
     ProcessInteractionsLauncher<MemSpace::host> launch(params, states);
     #pragma omp parallel for
-    for (size_type i = 0; i < states.size(); ++i)
+    for (size_type i = 0; i < states.num_active; ++i)
     {
         launch(ThreadId{i});
     }
@@ -24,7 +24,7 @@ __global__ void process_interactions_kernel(
     StateDeviceRef const states)
 {
     auto tid = KernelParamCalculator::thread_id();
-    if (!(tid < states.size()))
+    if (!(tid < states.num_active))
         return;
 
     ProcessInteractionsLauncher<MemSpace::device> launch(params, states);
@@ -41,7 +41,7 @@ void process_interactions(
 
     static const KernelParamCalculator process_interactions_ckp(
         process_interactions_kernel, "process_interactions");
-    auto kp = process_interactions_ckp(states.size());
+    auto kp = process_interactions_ckp(states.num_active);
     process_interactions_kernel<<<kp.grid_size, kp.block_size>>>(
         params, states);
     CELER_CUDA_CHECK_ERROR();
@@ -75,9 +75,9 @@ void {func}_interact(
 
     detail::{class}Launcher<MemSpace::host> launch({func}_data, model);
     #pragma omp parallel for
-    for (size_type i = 0; i < model.states.size(); ++i)
+    for (size_type i = 0; i < model.num_threads(); ++i)
     {{
-        ThreadId tid{{i}};
+        ThreadId tid = model.track_slot(ThreadId{{i}});
         launch(tid);
     }}
 }}
@@ -104,11 +104,11 @@ __global__ void {func}_interact_kernel(
     const ModelInteractRef<MemSpace::device> model)
 {{
     auto tid = KernelParamCalculator::thread_id();
-    if (!(tid < model.states.size()))
+    if (!(tid < model.num_threads()))
         return;
 
     detail::{class}Launcher<MemSpace::device> launch({func}_data, model);
-    launch(tid);
+    launch(model.track_slot(tid));
 }}
 }} // namespace
 
@@ -121,7 +121,7 @@ void {func}_interact(
 
     static const KernelParamCalculator calc_kernel_params(
         {func}_interact_kernel, "{func}_interact");
-    auto params = calc_kernel_params(model.states.size());
+    auto params = calc_kernel_params(model.num_threads());
     {func}_interact_kernel<<<params.grid_size, params.block_size>>>(
         {func}_data, model);
     CELER_CUDA_CHECK_ERROR();
@@ -0,0 +1,84 @@
+//----------------------------------*-C++-*----------------------------------//
+// Copyright 2021 UT-Battelle, LLC, and other Celeritas developers.
+// See the top-level COPYRIGHT file for details.
+// SPDX-License-Identifier: (Apache-2.0 OR MIT)
+//---------------------------------------------------------------------------//
+//! \file BinaryArchive.cc
+//---------------------------------------------------------------------------//
+#include "BinaryArchive.hh"
+
+#include <istream>
+#include <ostream>
+
+namespace celeritas
+{
+namespace
+{
+//---------------------------------------------------------------------------//
+/*!
+ * Update a 64-bit FNV-1a hash with a block of bytes.
+ */
+std::uint64_t fnv1a(std::uint64_t hash, const void* data, std::size_t count)
+{
+    constexpr std::uint64_t prime = 0x100000001b3ull;
+
+    const auto* bytes = static_cast<const unsigned char*>(data);
+    for (std::size_t i = 0; i != count; ++i)
+    {
+        hash ^= bytes[i];
+        hash *= prime;
+    }
+    return hash;
+}
+
+constexpr std::uint64_t fnv1a_offset_basis = 0xcbf29ce484222325ull;
+
+//---------------------------------------------------------------------------//
+} // namespace
+
+//---------------------------------------------------------------------------//
+/*!
+ * Construct with an optional output stream.
+ */
+BinaryWriter::BinaryWriter(std::ostream* os)
+    : os_(os), checksum_(fnv1a_offset_basis)
+{
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * Write and hash a block of bytes.
+ */
+void BinaryWriter::write(const void* data, std::size_t count)
+{
+    checksum_ = fnv1a(checksum_, data, count);
+    if (os_)
+    {
+        os_->write(static_cast<const char*>(data), count);
+        CELER_VALIDATE(*os_, << "failed to write " << count << " bytes");
+    }
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * Construct with an input stream.
+ */
+BinaryReader::BinaryReader(std::istream* is)
+    : is_(is), checksum_(fnv1a_offset_basis)
+{
+    CELER_EXPECT(is_);
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * Read and hash a block of bytes.
+ */
+void BinaryReader::read(void* data, std::size_t count)
+{
+    is_->read(static_cast<char*>(data), count);
+    CELER_VALIDATE(*is_, << "failed to read " << count << " bytes");
+    checksum_ = fnv1a(checksum_, data, count);
+}
+
+//---------------------------------------------------------------------------//
+} // namespace celeritas
@@ -0,0 +1,162 @@
+//----------------------------------*-C++-*----------------------------------//
+// Copyright 2021 UT-Battelle, LLC, and other Celeritas developers.
+// See the top-level COPYRIGHT file for details.
+// SPDX-License-Identifier: (Apache-2.0 OR MIT)
+//---------------------------------------------------------------------------//
+//! \file BinaryArchive.hh
+//---------------------------------------------------------------------------//
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <iosfwd>
+#include <type_traits>
+#include "Assert.hh"
+#include "Collection.hh"
+#include "CollectionBuilder.hh"
+#include "Types.hh"
+
+namespace celeritas
+{
+//---------------------------------------------------------------------------//
+/*!
+ * Write trivially copyable values and host collections as raw bytes.
+ *
+ * The writer keeps a running 64-bit FNV-1a checksum of everything written so
+ * that a reader can detect corrupt or truncated data. If no stream is given,
+ * the data is only hashed, which is useful for building a key that
+ * identifies a set of input data.
+ *
+ * The byte layout is that of the host, so archives are only portable between
+ * builds with the same architecture and \c real_type.
+ *
+ * \code
+    std::ofstream  out(filename, std::ios::binary);
+    BinaryWriter   write(&out);
+    write(data.scalar);
+    write(data.reals);
+    write(write.checksum());
+   \endcode
+ */
+class BinaryWriter
+{
+  public:
+    // Construct with an optional output stream
+    explicit BinaryWriter(std::ostream* os = nullptr);
+
+    // Write a trivially copyable value
+    template<class T>
+    inline BinaryWriter& operator()(const T& value);
+
+    // Write the size and contents of a host collection
+    template<class T, Ownership W, class I>
+    inline BinaryWriter&
+    operator()(const Collection<T, W, MemSpace::host, I>& items);
+
+    //! Checksum of the data written so far
+    std::uint64_t checksum() const { return checksum_; }
+
+  private:
+    std::ostream* os_;
+    std::uint64_t checksum_;
+
+    void write(const void* data, std::size_t count);
+};
+
+//---------------------------------------------------------------------------//
+/*!
+ * Read values and host collections written by \c BinaryWriter.
+ *
+ * Stream errors (e.g. a truncated file) raise a runtime error. The checksum
+ * of the data read so far can be compared against the checksum stored by the
+ * writer.
+ */
+class BinaryReader
+{
+  public:
+    // Construct with an input stream
+    explicit BinaryReader(std::istream* is);
+
+    // Read a trivially copyable value
+    template<class T>
+    inline BinaryReader& operator()(T& value);
+
+    // Read the size and contents of a host collection
+    template<class T, class I>
+    inline BinaryReader&
+    operator()(Collection<T, Ownership::value, MemSpace::host, I>& items);
+
+    //! Checksum of the data read so far
+    std::uint64_t checksum() const { return checksum_; }
+
+  private:
+    std::istream* is_;
+    std::uint64_t checksum_;
+
+    void read(void* data, std::size_t count);
+};
+
+//---------------------------------------------------------------------------//
+// INLINE DEFINITIONS
+//---------------------------------------------------------------------------//
+/*!
+ * Write a trivially copyable value.
+ */
+template<class T>
+BinaryWriter& BinaryWriter::operator()(const T& value)
+{
+    static_assert(std::is_trivially_copyable<T>::value,
+                  "Data is not trivially copyable");
+    this->write(&value, sizeof(T));
+    return *this;
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * Write the size and contents of a host collection.
+ */
+template<class T, Ownership W, class I>
+BinaryWriter&
+BinaryWriter::operator()(const Collection<T, W, MemSpace::host, I>& items)
+{
+    static_assert(std::is_trivially_copyable<T>::value,
+                  "Data is not trivially copyable");
+    auto data = items[AllItems<T, MemSpace::host>{}];
+    (*this)(static_cast<std::uint64_t>(data.size()));
+    this->write(data.data(), data.size() * sizeof(T));
+    return *this;
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * Read a trivially copyable value.
+ */
+template<class T>
+BinaryReader& BinaryReader::operator()(T& value)
+{
+    static_assert(std::is_trivially_copyable<T>::value,
+                  "Data is not trivially copyable");
+    this->read(&value, sizeof(T));
+    return *this;
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * Read the size and contents of a host collection.
+ */
+template<class T, class I>
+BinaryReader& BinaryReader::operator()(
+    Collection<T, Ownership::value, MemSpace::host, I>& items)
+{
+    static_assert(std::is_trivially_copyable<T>::value,
+                  "Data is not trivially copyable");
+    std::uint64_t size = 0;
+    (*this)(size);
+    resize(&items, static_cast<size_type>(size));
+    auto data = items[AllItems<T, MemSpace::host>{}];
+    this->read(data.data(), data.size() * sizeof(T));
+    return *this;
+}
+
+//---------------------------------------------------------------------------//
+} // namespace celeritas
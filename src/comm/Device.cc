@@ -226,5 +226,17 @@ void set_cuda_stack_size(int limit)
     CELER_CUDA_CALL(cudaDeviceSetLimit(cudaLimitStackSize, limit));
 }
 
+//---------------------------------------------------------------------------//
+/*!
+ * Wait for all kernels on the active device to complete.
+ *
+ * This is needed for accurate wall-clock timing of asynchronous kernels.
+ */
+void device_synchronize()
+{
+    CELER_EXPECT(celeritas::device());
+    CELER_CUDA_CALL(cudaDeviceSynchronize());
+}
+
 //---------------------------------------------------------------------------//
 } // namespace celeritas
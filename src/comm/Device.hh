@@ -91,6 +91,9 @@ std::ostream& operator<<(std::ostream&, const Device&);
 // Increase CUDA stack size
 void set_cuda_stack_size(int limit);
 
+// Wait for all kernels on the active device to complete
+void device_synchronize();
+
 //---------------------------------------------------------------------------//
 // INLINE FUNCTION DEFINITIONS
 //---------------------------------------------------------------------------//
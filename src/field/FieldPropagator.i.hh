@@ -122,7 +122,12 @@ FieldPropagator<DriverT>::query_intersection(const Real3&  beg_pos,
     real_type length = norm(chord);
     CELER_ASSERT(length > 0);
 
-    real_type safety = track_->find_safety(beg_pos);
+    // Use the cached safety sphere if the chord is inside it
+    real_type safety = track_->safety(beg_pos);
+    if (length > safety)
+    {
+        safety = track_->update_safety(beg_pos);
+    }
     if (length > safety)
     {
         // Check whether the linear step length to the next boundary is
@@ -21,6 +21,17 @@ namespace celeritas
 /*!
  * Operate on the device with shared (persistent) data and local state.
  *
+ * The search for the next boundary is deferred until it's needed: the
+ * initializers and boundary crossings only locate the new volume. Moving by
+ * a distance searches for a boundary no further than that distance, so a step
+ * limited by physics doesn't pay for a full traversal of the volume. The
+ * distance to the boundary is calculated on demand by \c next_step.
+ *
+ * The state also caches an isotropic safety distance and the position where
+ * it was found. As long as a straight step stays inside that sphere, the
+ * track is moved without calling the navigator (like Geant4's
+ * G4SafetyHelper). The sphere is invalidated whenever the volume changes.
+ *
  * \code
     GeoTrackView geom(vg_view, vg_state_view, thread_id);
    \endcode
@@ -69,13 +80,17 @@ class GeoTrackView
     //! State accessors
     CELER_FUNCTION const Real3& pos() const { return pos_; }
     CELER_FUNCTION const Real3& dir() const { return dir_; }
-    CELER_FUNCTION real_type next_step() const
-    {
-        CELER_ASSERT(!dirty_);
-        return next_step_;
-    }
     //!@}
 
+    // Get the distance to the next boundary, searching if needed
+    inline CELER_FUNCTION real_type next_step();
+
+    // Get the distance to the edge of the cached safety sphere
+    inline CELER_FUNCTION real_type safety(const Real3& pos) const;
+
+    // Find the safety at a position and cache it
+    inline CELER_FUNCTION real_type update_safety(const Real3& pos);
+
     //!@{
     //! State modifiers will force state update before next step
     CELER_FUNCTION void set_pos(const Real3& newpos)
@@ -116,6 +131,8 @@ class GeoTrackView
     Real3&     pos_;
     Real3&     dir_;
     real_type& next_step_;
+    Real3&     safety_pos_;
+    real_type& safety_;
     // Flag to trigger update of geometry information if and only if needed
     bool dirty_;
     //!@}
@@ -127,6 +144,9 @@ class GeoTrackView
     // Find the distance to the next boundary
     inline CELER_FUNCTION void find_next_step_outside();
 
+    // Find the next boundary if it's no further than the given distance
+    inline CELER_FUNCTION bool find_next_step_within(real_type max_step);
+
   public:
     //! Get a reference to the current volume
     inline CELER_FUNCTION const Volume& volume() const;
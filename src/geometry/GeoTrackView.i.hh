@@ -28,6 +28,8 @@ GeoTrackView::GeoTrackView(const GeoParamsRef& data,
     , pos_(stateview.pos[thread])
     , dir_(stateview.dir[thread])
     , next_step_(stateview.next_step[thread])
+    , safety_pos_(stateview.safety_pos[thread])
+    , safety_(stateview.safety[thread])
     , dirty_(true)
 {
 }
@@ -43,8 +45,9 @@ GeoTrackView::GeoTrackView(const GeoParamsRef& data,
 CELER_FUNCTION GeoTrackView& GeoTrackView::operator=(const Initializer_t& init)
 {
     // Initialize position/direction
-    pos_ = init.pos;
-    dir_ = init.dir;
+    pos_    = init.pos;
+    dir_    = init.dir;
+    safety_ = 0;
 
     // Set up current state and locate daughter volume.
     vgstate_.Clear();
@@ -57,13 +60,8 @@ CELER_FUNCTION GeoTrackView& GeoTrackView::operator=(const Initializer_t& init)
     Navigator::LocatePointIn(
         worldvol, detail::to_vector(pos_), vgstate_, contains_point);
 
-    // Prepare for next step. If outside, vgstate_ will be reset to return
-    //  world volume instead of null.
-    if (this->is_outside())
-        this->find_next_step_outside();
-    else
-        this->find_next_step();
-
+    // Defer the search for the next boundary until the track moves
+    dirty_ = true;
     return *this;
 }
 
@@ -79,11 +77,14 @@ GeoTrackView& GeoTrackView::operator=(const DetailedInitializer& init)
         // Copy the navigation state and position from the parent state
         init.other.vgstate_.CopyTo(&vgstate_);
         pos_ = init.other.pos_;
-    }
-    // Set up the next state and initialize the direction
-    dir_ = init.dir;
 
-    this->find_next_step();
+        // The safety sphere doesn't depend on direction
+        safety_pos_ = init.other.safety_pos_;
+        safety_     = init.other.safety_;
+    }
+    // Initialize the direction; the next state is found when needed
+    dir_   = init.dir;
+    dirty_ = true;
     return *this;
 }
 
@@ -98,8 +99,6 @@ CELER_FORCEINLINE_FUNCTION void GeoTrackView::find_next_step()
     else
     {
         // Use BVH navigator
-        // Note: AdePT provides max phys.length as maxStep
-        //  - if used, next state = current state
         next_step_
             = Navigator::ComputeStepAndNextVolume(detail::to_vector(pos_),
                                                   detail::to_vector(dir_),
@@ -111,6 +110,48 @@ CELER_FORCEINLINE_FUNCTION void GeoTrackView::find_next_step()
     dirty_ = false;
 }
 
+//---------------------------------------------------------------------------//
+/*!
+ * Find the next geometric boundary if it's within the given distance.
+ *
+ * The navigator search is limited to \c max_step as in AdePT. If no boundary
+ * is that close, the next state is the current state and the distance to the
+ * boundary remains unknown (dirty).
+ */
+CELER_FUNCTION bool GeoTrackView::find_next_step_within(real_type max_step)
+{
+    if (this->is_outside())
+    {
+        this->find_next_step_outside();
+        return true;
+    }
+
+    real_type step
+        = Navigator::ComputeStepAndNextVolume(detail::to_vector(pos_),
+                                              detail::to_vector(dir_),
+                                              max_step,
+                                              vgstate_,
+                                              vgnext_);
+    if (!vgnext_.IsOnBoundary())
+    {
+        // Step is limited by the requested distance
+        return false;
+    }
+
+    next_step_ = step;
+    dirty_     = false;
+    return true;
+}
+
+//---------------------------------------------------------------------------//
+//! Get the distance to the next boundary, searching if needed
+CELER_FUNCTION real_type GeoTrackView::next_step()
+{
+    if (dirty_)
+        this->find_next_step();
+    return next_step_;
+}
+
 //---------------------------------------------------------------------------//
 //! For outside points, find distance to world volume
 CELER_FUNCTION void GeoTrackView::find_next_step_outside()
@@ -152,8 +193,20 @@ CELER_FUNCTION real_type GeoTrackView::move_to_boundary()
 CELER_FUNCTION real_type GeoTrackView::move_by(real_type dist)
 {
     CELER_EXPECT(dist > 0.);
-    if (dirty_)
-        this->find_next_step();
+    if (dirty_ && dist < this->safety(pos_))
+    {
+        // Step is inside the safety sphere: no navigation is needed
+        axpy(dist, dir_, &pos_);
+        return dist;
+    }
+    if (dirty_ && !this->find_next_step_within(dist))
+    {
+        // No boundary within the step: the track is away from the volume
+        // edges, so cache the safety for the steps that follow
+        this->update_safety(pos_);
+        axpy(dist, dir_, &pos_);
+        return dist;
+    }
 
     // do not move beyond next boundary!
     if (dist >= next_step_)
@@ -182,7 +235,39 @@ CELER_FUNCTION void GeoTrackView::relocate()
     }
 
     vgstate_ = vgnext_; // BVH relocation requires this extra step
-    find_next_step();
+    dirty_   = true;
+    safety_  = 0;
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * Get the distance from a position to the edge of the cached safety sphere.
+ *
+ * The result is zero if the position is outside the sphere.
+ */
+CELER_FUNCTION real_type GeoTrackView::safety(const Real3& pos) const
+{
+    if (safety_ <= 0)
+        return 0;
+
+    Real3 delta = pos;
+    axpy(real_type(-1), safety_pos_, &delta);
+    real_type remaining = safety_ - norm(delta);
+    return remaining > 0 ? remaining : 0;
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * Find the safety at a position in the current volume and cache it.
+ */
+CELER_FUNCTION real_type GeoTrackView::update_safety(const Real3& pos)
+{
+    if (this->is_outside())
+        return 0;
+
+    safety_pos_ = pos;
+    safety_     = this->find_safety(pos);
+    return safety_;
 }
 
 //---------------------------------------------------------------------------//
@@ -253,5 +338,6 @@ CELER_FUNCTION void GeoTrackView::propagate_state(Real3 pos, Real3 dir) const
     vgstate_ = vgnext_;
     vgstate_.SetBoundaryState(true);
     vgnext_.Clear();
+    safety_ = 0;
 }
 } // namespace celeritas
@@ -7,8 +7,10 @@
 //---------------------------------------------------------------------------//
 #include "VGNavCollection.hh"
 
+#include <cstdint>
 #include <VecGeom/navigation/NavStatePool.h>
 #include "base/CollectionBuilder.hh"
+#include "base/Range.hh"
 #include "comm/Device.hh"
 
 namespace celeritas
@@ -17,21 +19,58 @@ namespace detail
 {
 //---------------------------------------------------------------------------//
 // HOST VALUE
+//---------------------------------------------------------------------------//
+/*!
+ * Destroy the navigation states and free the storage.
+ */
+void HostNavStateDeleter::operator()(char* storage) const
+{
+    using NavState = vecgeom::cxx::NavigationState;
+
+    char* first = storage + offset;
+    for (auto i : range(count))
+    {
+        reinterpret_cast<NavState*>(first + i * stride)->~NavState();
+    }
+    delete[] storage;
+}
+
 //---------------------------------------------------------------------------//
 /*!
  * Resize with a number of states.
+ *
+ * All states are allocated at once and aligned like the device pool.
  */
 void VGNavCollection<Ownership::value, MemSpace::host>::resize(int max_depth,
                                                                size_type size)
 {
     CELER_EXPECT(max_depth > 0);
 
-    // Add navigation states to collection
-    this->nav_state.resize(size);
-    for (UPNavState& state : this->nav_state)
+    // Free existing states before allocating new ones
+    this->storage.reset();
+
+    HostNavStateDeleter deleter;
+    deleter.stride = NavState::SizeOfInstanceAlignAware(max_depth);
+    deleter.count  = size;
+
+    // Allocate extra space to align the first state
+    const size_type align = vecgeom::kAlignmentBoundary;
+    char*           raw   = new char[size * deleter.stride + align];
+    auto            addr  = reinterpret_cast<std::uintptr_t>(raw);
+    deleter.offset        = (align - addr % align) % align;
+
+    // Construct states in place
+    char* first = raw + deleter.offset;
+    for (auto i : range(size))
     {
-        state = std::unique_ptr<NavState>(NavState::MakeInstance(max_depth));
+        NavState::MakeInstanceAt(max_depth, first + i * deleter.stride);
     }
+
+    this->storage   = UPStorage(raw, deleter);
+    this->ptr       = first;
+    this->stride    = deleter.stride;
+    this->max_depth = max_depth;
+    this->size      = size;
 }
 
 //---------------------------------------------------------------------------//
@@ -43,20 +82,27 @@ void VGNavCollection<Ownership::value, MemSpace::host>::resize(int max_depth,
 void VGNavCollection<Ownership::reference, MemSpace::host>::operator=(
     VGNavCollection<Ownership::value, MemSpace::host>& other)
 {
-    nav_state = make_span(other.nav_state);
+    CELER_ASSERT(other);
+    ptr       = other.ptr;
+    stride    = other.stride;
+    max_depth = other.max_depth;
+    size      = other.size;
 }
 
 //---------------------------------------------------------------------------//
 /*!
- * Get the navigation state at the given thread, which must be zero.
+ * Get the navigation state at the given thread.
+ *
+ * The max_depth argument is used for error checking against the allocated
+ * max_depth.
  */
-auto VGNavCollection<Ownership::reference, MemSpace::host>::at(int,
-                                                               ThreadId id) const
-    -> NavState&
+auto VGNavCollection<Ownership::reference, MemSpace::host>::at(
+    int max_depth_param, ThreadId id) const -> NavState&
 {
     CELER_EXPECT(*this);
-    CELER_EXPECT(id < nav_state.size());
-    return *nav_state[id.unchecked_get()];
+    CELER_EXPECT(id < size);
+    CELER_EXPECT(max_depth_param == max_depth);
+    return *reinterpret_cast<NavState*>(ptr + id.unchecked_get() * stride);
 }
 
 //---------------------------------------------------------------------------//
@@ -8,12 +8,10 @@
 #pragma once
 
 #include <memory>
-#include <vector>
 #include <VecGeom/navigation/NavigationState.h>
 #include <VecGeom/navigation/NavStatePool.h>
 #include "base/Assert.hh"
 #include "base/OpaqueId.hh"
-#include "base/Span.hh"
 #include "base/Types.hh"
 
 namespace celeritas
@@ -46,43 +44,67 @@ struct VGNavCollection<Ownership::reference, MemSpace::device>;
 // HOST MEMSPACE
 //---------------------------------------------------------------------------//
 /*!
- * Manage a single navigation state in host memory.
+ * Destroy host navigation states and free their storage.
  *
- * Since navigation states are allocated on the heap, and don't have a default
- * contructor, we must use a `unique_ptr` to manage its memory.
+ * The states are constructed in place in a single allocation, so they must be
+ * destroyed individually before the storage is released.
+ */
+struct HostNavStateDeleter
+{
+    size_type offset = 0; //!< Offset of the first (aligned) state
+    size_type stride = 0; //!< Aligned size of a single state
+    size_type count  = 0; //!< Number of states
+
+    void operator()(char* storage) const;
+};
+
+//---------------------------------------------------------------------------//
+/*!
+ * Manage navigation states in host memory.
+ *
+ * Navigation states don't have a default constructor and their size depends
+ * on the maximum geometry depth. Like the \c NavStatePool on device, all
+ * states are constructed in place in a single aligned allocation, one state
+ * per track slot with a constant stride.
  */
 template<>
 struct VGNavCollection<Ownership::value, MemSpace::host>
 {
-    using NavState   = vecgeom::cxx::NavigationState;
-    using UPNavState = std::unique_ptr<NavState>;
+    using NavState  = vecgeom::cxx::NavigationState;
+    using UPStorage = std::unique_ptr<char[], HostNavStateDeleter>;
 
-    std::vector<UPNavState> nav_state;
+    UPStorage storage;
+    char*     ptr       = nullptr;
+    size_type stride    = 0;
+    int       max_depth = 0;
+    size_type size      = 0;
 
     // Resize with a number of states
     void resize(int max_depth, size_type size);
-    // Whether the collection is assigned
-    explicit operator bool() const { return !nav_state.empty(); }
+    //! Whether the collection is assigned
+    explicit operator bool() const { return ptr != nullptr; }
 };
 
 //---------------------------------------------------------------------------//
 /*!
- * Reference a host-owned navigation state.
+ * Reference host-owned navigation states.
  */
 template<>
 struct VGNavCollection<Ownership::reference, MemSpace::host>
 {
-    using NavState   = vecgeom::cxx::NavigationState;
-    using UPNavState = std::unique_ptr<NavState>;
+    using NavState = vecgeom::cxx::NavigationState;
 
-    Span<UPNavState> nav_state;
+    char*     ptr       = nullptr;
+    size_type stride    = 0;
+    int       max_depth = 0;
+    size_type size      = 0;
 
     // Obtain reference from host memory
     void operator=(VGNavCollection<Ownership::value, MemSpace::host>& other);
     // Get the navigation state for a given thread
-    NavState& at(int, ThreadId id) const;
+    NavState& at(int max_depth, ThreadId id) const;
     //! True if the collection is assigned/valiid
-    explicit operator bool() const { return !nav_state.empty(); }
+    explicit operator bool() const { return ptr != nullptr; }
 };
 
 //---------------------------------------------------------------------------//
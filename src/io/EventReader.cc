@@ -7,6 +7,7 @@
 //---------------------------------------------------------------------------//
 #include "EventReader.hh"
 
+#include <limits>
 #include <HepMC3/GenEvent.h>
 #include <HepMC3/ReaderFactory.h>
 
@@ -39,67 +40,118 @@ EventReader::~EventReader() = default;
 
 //---------------------------------------------------------------------------//
 /*!
- * Read the primary particles from the event record.
+ * Read the primary particles from all remaining events in the record.
  */
 EventReader::result_type EventReader::operator()()
 {
-    result_type result;
-    int         event_id = -1;
+    return (*this)(std::numeric_limits<size_type>::max(),
+                   std::numeric_limits<size_type>::max());
+}
 
-    while (!input_file_->failed())
-    {
-        // Parse the next event from the record
-        HepMC3::GenEvent gen_event;
-        input_file_->read_event(gen_event);
+//---------------------------------------------------------------------------//
+/*!
+ * Read the primary particles from the next batch of events.
+ *
+ * Whole events are read until either the next event would exceed the maximum
+ * number of primaries or the maximum number of events is reached. An event
+ * that does not fit is kept for the next batch. An empty result means all
+ * events have been read.
+ */
+EventReader::result_type
+EventReader::operator()(size_type max_events, size_type max_primaries)
+{
+    CELER_EXPECT(max_events > 0);
+    CELER_EXPECT(max_primaries > 0);
 
-        // There are no more events
-        if (input_file_->failed())
+    result_type result;
+    for (size_type num_events = 0; num_events < max_events; ++num_events)
+    {
+        if (!has_next_event_ && !this->read_event())
+        {
+            // There are no more events
+            break;
+        }
+        if (!result.empty()
+            && next_event_.size() > max_primaries - result.size())
         {
+            // Save the event for the next batch
             break;
         }
-        ++event_id;
+        result.insert(result.end(), next_event_.begin(), next_event_.end());
+        has_next_event_ = false;
+    }
+    return result;
+}
 
-        int track_id = 0;
+//---------------------------------------------------------------------------//
+/*!
+ * Read the primary particles from the next event into the event buffer.
+ *
+ * \return Whether an event was read
+ */
+bool EventReader::read_event()
+{
+    CELER_EXPECT(!has_next_event_);
 
-        // Convert the energy units to MeV and the length units to cm
-        gen_event.set_units(HepMC3::Units::MEV, HepMC3::Units::CM);
+    if (input_file_->failed())
+    {
+        // The end of the record was already reached
+        return false;
+    }
 
-        for (auto gen_particle : gen_event.particles())
-        {
-            // Get the PDG code and check if this particle type is defined for
-            // the current physics
-            PDGNumber  pdg{gen_particle->pid()};
-            ParticleId particle_id{params_->find(pdg)};
-            CELER_ASSERT(particle_id);
+    // Parse the next event from the record
+    HepMC3::GenEvent gen_event;
+    input_file_->read_event(gen_event);
 
-            Primary primary;
+    // There are no more events
+    if (input_file_->failed())
+    {
+        return false;
+    }
+    EventId event_id{num_events_++};
 
-            // Set the registered ID of the particle
-            primary.particle_id = particle_id;
+    int track_id = 0;
 
-            // Set the event and track number
-            primary.event_id = EventId(event_id);
-            primary.track_id = TrackId(track_id++);
+    // Convert the energy units to MeV and the length units to cm
+    gen_event.set_units(HepMC3::Units::MEV, HepMC3::Units::CM);
 
-            // Get the position of the primary
-            auto pos         = gen_event.event_pos();
-            primary.position = {pos.x() * units::centimeter,
-                                pos.y() * units::centimeter,
-                                pos.z() * units::centimeter};
+    next_event_.clear();
+    for (auto gen_particle : gen_event.particles())
+    {
+        // Get the PDG code and check if this particle type is defined for
+        // the current physics
+        PDGNumber  pdg{gen_particle->pid()};
+        ParticleId particle_id{params_->find(pdg)};
+        CELER_ASSERT(particle_id);
 
-            // Get the direction of the primary
-            primary.direction = {gen_particle->momentum().px(),
-                                 gen_particle->momentum().py(),
-                                 gen_particle->momentum().pz()};
-            normalize_direction(&primary.direction);
+        Primary primary;
 
-            // Get the energy of the primary
-            primary.energy = units::MevEnergy{gen_particle->momentum().e()};
+        // Set the registered ID of the particle
+        primary.particle_id = particle_id;
 
-            result.push_back(primary);
-        }
+        // Set the event and track number
+        primary.event_id = event_id;
+        primary.track_id = TrackId(track_id++);
+
+        // Get the position of the primary
+        auto pos         = gen_event.event_pos();
+        primary.position = {pos.x() * units::centimeter,
+                            pos.y() * units::centimeter,
+                            pos.z() * units::centimeter};
+
+        // Get the direction of the primary
+        primary.direction = {gen_particle->momentum().px(),
+                             gen_particle->momentum().py(),
+                             gen_particle->momentum().pz()};
+        normalize_direction(&primary.direction);
+
+        // Get the energy of the primary
+        primary.energy = units::MevEnergy{gen_particle->momentum().e()};
+
+        next_event_.push_back(primary);
     }
-    return result;
+    has_next_event_ = true;
+    return true;
 }
 
 //---------------------------------------------------------------------------//
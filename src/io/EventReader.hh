@@ -23,6 +23,21 @@ namespace celeritas
  * Read an event record file using the HepMC3 event record library and create
  * primary particles. Supported forrmats are Asciiv3, IO_GenEvent, HEPEVT, and
  * LHEF.
+ *
+ * Events can either be read all at once or incrementally in batches that are
+ * limited by the number of events and the number of primaries. Events are
+ * never split across batches, so a batch always contains at least one event
+ * (unless the file is exhausted) even if that event has more primaries than
+ * the limit. Event IDs are numbered consecutively across batches.
+ *
+ * \code
+    EventReader read_events(filename, particles);
+    for (auto primaries = read_events(100, 4096); !primaries.empty();
+         primaries = read_events(100, 4096))
+    {
+        ...
+    }
+   \endcode
  */
 class EventReader
 {
@@ -40,15 +55,29 @@ class EventReader
     // Default destructor in .cc
     ~EventReader();
 
-    // Generate primary particles from the event record
+    // Generate primary particles from all remaining events
     result_type operator()();
 
+    // Generate primary particles from the next batch of events
+    result_type operator()(size_type max_events, size_type max_primaries);
+
   private:
     // Shared standard model particle data
     SPConstParticles params_;
 
     // HepMC3 event record reader
     std::shared_ptr<HepMC3::Reader> input_file_;
+
+    // Number of events read so far
+    EventId::size_type num_events_{0};
+
+    // Primaries from an event that was read but did not fit in a batch
+    result_type next_event_;
+    bool        has_next_event_{false};
+
+    //// HELPER FUNCTIONS ////
+
+    bool read_event();
 };
 
 //---------------------------------------------------------------------------//
@@ -22,5 +22,10 @@ EventReader::result_type EventReader::operator()()
     CELER_ASSERT_UNREACHABLE();
 }
 
+EventReader::result_type EventReader::operator()(size_type, size_type)
+{
+    CELER_ASSERT_UNREACHABLE();
+}
+
 //---------------------------------------------------------------------------//
 } // namespace celeritas
@@ -7,6 +7,7 @@
 //---------------------------------------------------------------------------//
 #pragma once
 
+#include "base/Array.hh"
 #include "base/Collection.hh"
 #include "base/CollectionBuilder.hh"
 #include "base/OpaqueId.hh"
@@ -125,6 +126,111 @@ struct VolumeData
     }
 };
 
+//---------------------------------------------------------------------------//
+/*!
+ * Axis-aligned bounding box.
+ *
+ * Bounds may be infinite. A box with any lower bound greater than its upper
+ * bound is empty.
+ */
+struct BoundingBox
+{
+    Real3 lower;
+    Real3 upper;
+};
+
+//---------------------------------------------------------------------------//
+/*!
+ * Acceleration structure for finding the volume that contains a point.
+ *
+ * Each volume has a (possibly infinite) axis-aligned bounding box. The finite
+ * region spanned by the bounded volumes is divided into a uniform grid, and
+ * each grid cell lists the volumes whose boxes overlap it in order of
+ * increasing volume ID. Points outside the grid can only be in the volumes
+ * listed in \c exterior, whose boxes extend beyond it.
+ *
+ * Cells are stored with the z index varying fastest.
+ */
+template<Ownership W, MemSpace M>
+struct VolumeGridData
+{
+    //// TYPES ////
+
+    template<class T>
+    using Items = Collection<T, W, M>;
+    using Size3 = Array<size_type, 3>;
+
+    //// DATA ////
+
+    Collection<BoundingBox, W, M, VolumeId> bboxes;
+
+    BoundingBox         extents{};  //!< Bounds of the grid
+    Size3               dims{};     //!< Number of cells along each axis
+    Real3               delta{};    //!< Cell width along each axis
+    ItemRange<VolumeId> exterior{}; //!< Volumes extending outside the grid
+
+    Items<ItemRange<VolumeId>> cells;   //!< Candidate volumes for each cell
+    Items<VolumeId>            volumes; //!< Storage for candidate volumes
+
+    //// METHODS ////
+
+    //! True if the grid has been built
+    explicit CELER_FUNCTION operator bool() const
+    {
+        return !bboxes.empty() && !cells.empty();
+    }
+
+    //! Assign from another set of data
+    template<Ownership W2, MemSpace M2>
+    VolumeGridData& operator=(const VolumeGridData<W2, M2>& other)
+    {
+        bboxes   = other.bboxes;
+        extents  = other.extents;
+        dims     = other.dims;
+        delta    = other.delta;
+        exterior = other.exterior;
+        cells    = other.cells;
+        volumes  = other.volumes;
+        return *this;
+    }
+};
+
+//---------------------------------------------------------------------------//
+/*!
+ * Volumes adjacent to each surface.
+ *
+ * A track crossing a surface can only enter a volume that has the surface as
+ * one of its faces. The neighbors of each surface are listed in order of
+ * increasing volume ID.
+ */
+template<Ownership W, MemSpace M>
+struct ConnectivityData
+{
+    //// DATA ////
+
+    //! Volumes bounded by each surface
+    Collection<ItemRange<VolumeId>, W, M, SurfaceId> neighbors;
+    //! Storage for neighboring volumes
+    Collection<VolumeId, W, M> volumes;
+
+    //// METHODS ////
+
+    //! True if the connectivity has been built
+    explicit CELER_FUNCTION operator bool() const
+    {
+        return !neighbors.empty();
+    }
+
+    //! Assign from another set of data
+    template<Ownership W2, MemSpace M2>
+    ConnectivityData& operator=(const ConnectivityData<W2, M2>& other)
+    {
+        neighbors = other.neighbors;
+        volumes   = other.volumes;
+        return *this;
+    }
+};
+
 //---------------------------------------------------------------------------//
 /*!
  * Scalar values particular to an ORANGE geometry instance.
@@ -153,8 +259,10 @@ struct OrangeParamsData
 {
     //// DATA ////
 
-    SurfaceData<W, M>  surfaces;
-    VolumeData<W, M>   volumes;
+    SurfaceData<W, M>      surfaces;
+    VolumeData<W, M>       volumes;
+    VolumeGridData<W, M>   volume_grid;  //!< Optional point location grid
+    ConnectivityData<W, M> connectivity; //!< Optional surface neighbors
 
     OrangeParamsScalars scalars;
 
@@ -171,9 +279,11 @@ struct OrangeParamsData
     OrangeParamsData& operator=(const OrangeParamsData<W2, M2>& other)
     {
         CELER_EXPECT(other);
-        surfaces  = other.surfaces;
-        volumes   = other.volumes;
-        scalars   = other.scalars;
+        surfaces     = other.surfaces;
+        volumes      = other.volumes;
+        volume_grid  = other.volume_grid;
+        connectivity = other.connectivity;
+        scalars      = other.scalars;
         return *this;
     }
 };
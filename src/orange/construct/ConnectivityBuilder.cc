@@ -0,0 +1,60 @@
+//----------------------------------*-C++-*----------------------------------//
+// Copyright 2021 UT-Battelle, LLC, and other Celeritas developers.
+// See the top-level COPYRIGHT file for details.
+// SPDX-License-Identifier: (Apache-2.0 OR MIT)
+//---------------------------------------------------------------------------//
+//! \file ConnectivityBuilder.cc
+//---------------------------------------------------------------------------//
+#include "ConnectivityBuilder.hh"
+
+#include <vector>
+#include "base/CollectionBuilder.hh"
+#include "base/Range.hh"
+
+namespace celeritas
+{
+//---------------------------------------------------------------------------//
+/*!
+ * Construct with a reference to empty connectivity data.
+ */
+ConnectivityBuilder::ConnectivityBuilder(Data* connectivity)
+    : connectivity_(connectivity)
+{
+    CELER_EXPECT(connectivity_ && !*connectivity_);
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * Find the volumes bounded by each surface.
+ */
+void ConnectivityBuilder::operator()(SurfaceId::size_type num_surfaces,
+                                     const VolumeDataRef& volumes)
+{
+    CELER_EXPECT(volumes);
+
+    // Invert the volume-to-face mapping; faces are unique in each volume
+    std::vector<std::vector<VolumeId>> neighbors(num_surfaces);
+    for (auto vol_id : range(VolumeId{volumes.size()}))
+    {
+        const VolumeDef& def = volumes.defs[vol_id];
+        for (SurfaceId sid : volumes.faces[def.faces])
+        {
+            CELER_ASSERT(sid < neighbors.size());
+            neighbors[sid.get()].push_back(vol_id);
+        }
+    }
+
+    // Store
+    auto volume_ids = make_builder(&connectivity_->volumes);
+    auto surf_data  = make_builder(&connectivity_->neighbors);
+    surf_data.reserve(neighbors.size());
+    for (const auto& vols : neighbors)
+    {
+        surf_data.push_back(volume_ids.insert_back(vols.begin(), vols.end()));
+    }
+
+    CELER_ENSURE(connectivity_->neighbors.size() == num_surfaces);
+}
+
+//---------------------------------------------------------------------------//
+} // namespace celeritas
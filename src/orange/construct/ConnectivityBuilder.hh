@@ -0,0 +1,50 @@
+//----------------------------------*-C++-*----------------------------------//
+// Copyright 2021 UT-Battelle, LLC, and other Celeritas developers.
+// See the top-level COPYRIGHT file for details.
+// SPDX-License-Identifier: (Apache-2.0 OR MIT)
+//---------------------------------------------------------------------------//
+//! \file ConnectivityBuilder.hh
+//---------------------------------------------------------------------------//
+#pragma once
+
+#include "../Data.hh"
+
+namespace celeritas
+{
+//---------------------------------------------------------------------------//
+/*!
+ * Construct the surface-to-volume connectivity on the host.
+ *
+ * This must be called after all volumes have been inserted, since the
+ * neighbors of a surface are only known once every volume that references it
+ * is defined.
+ *
+ * \code
+   ConnectivityBuilder build_connectivity(&params.connectivity);
+   build_connectivity(params.surfaces.size(), volume_ref);
+   \endcode
+ */
+class ConnectivityBuilder
+{
+  public:
+    //!@{
+    //! Type aliases
+    using Data = ConnectivityData<Ownership::value, MemSpace::host>;
+    using VolumeDataRef
+        = VolumeData<Ownership::const_reference, MemSpace::host>;
+    //!@}
+
+  public:
+    // Construct with reference to the connectivity to build
+    explicit ConnectivityBuilder(Data* connectivity);
+
+    // Find the volumes bounded by each surface
+    void operator()(SurfaceId::size_type num_surfaces,
+                    const VolumeDataRef& volumes);
+
+  private:
+    Data* connectivity_{nullptr};
+};
+
+//---------------------------------------------------------------------------//
+} // namespace celeritas
@@ -0,0 +1,356 @@
+//----------------------------------*-C++-*----------------------------------//
+// Copyright 2021 UT-Battelle, LLC, and other Celeritas developers.
+// See the top-level COPYRIGHT file for details.
+// SPDX-License-Identifier: (Apache-2.0 OR MIT)
+//---------------------------------------------------------------------------//
+//! \file VolumeGridBuilder.cc
+//---------------------------------------------------------------------------//
+#include "VolumeGridBuilder.hh"
+
+#include <algorithm>
+#include <cmath>
+#include <limits>
+#include <utility>
+#include <vector>
+#include "base/CollectionBuilder.hh"
+#include "base/Range.hh"
+#include "../surfaces/CylCentered.hh"
+#include "../surfaces/PlaneAligned.hh"
+#include "../surfaces/Sphere.hh"
+#include "../surfaces/Surfaces.hh"
+
+namespace celeritas
+{
+namespace
+{
+//---------------------------------------------------------------------------//
+// TYPES
+//---------------------------------------------------------------------------//
+//! Bounds of a logical expression and of its complement
+struct LogicBoxes
+{
+    BoundingBox region;
+    BoundingBox complement;
+};
+
+//---------------------------------------------------------------------------//
+// HELPER FUNCTIONS
+//---------------------------------------------------------------------------//
+constexpr real_type inf = std::numeric_limits<real_type>::infinity();
+
+BoundingBox infinite_bbox()
+{
+    return {{-inf, -inf, -inf}, {inf, inf, inf}};
+}
+
+BoundingBox empty_bbox()
+{
+    return {{inf, inf, inf}, {-inf, -inf, -inf}};
+}
+
+bool is_empty(const BoundingBox& bbox)
+{
+    for (auto ax : range(3))
+    {
+        if (bbox.lower[ax] > bbox.upper[ax])
+            return true;
+    }
+    return false;
+}
+
+bool is_finite(const BoundingBox& bbox)
+{
+    for (auto ax : range(3))
+    {
+        if (!std::isfinite(bbox.lower[ax]) || !std::isfinite(bbox.upper[ax]))
+            return false;
+    }
+    return !is_empty(bbox);
+}
+
+//! Whether the first box is entirely inside the second
+bool is_within(const BoundingBox& inner, const BoundingBox& outer)
+{
+    for (auto ax : range(3))
+    {
+        if (inner.lower[ax] < outer.lower[ax]
+            || inner.upper[ax] > outer.upper[ax])
+            return false;
+    }
+    return true;
+}
+
+BoundingBox calc_union(const BoundingBox& a, const BoundingBox& b)
+{
+    BoundingBox result;
+    for (auto ax : range(3))
+    {
+        result.lower[ax] = std::min(a.lower[ax], b.lower[ax]);
+        result.upper[ax] = std::max(a.upper[ax], b.upper[ax]);
+    }
+    return result;
+}
+
+BoundingBox calc_intersection(const BoundingBox& a, const BoundingBox& b)
+{
+    BoundingBox result;
+    for (auto ax : range(3))
+    {
+        result.lower[ax] = std::max(a.lower[ax], b.lower[ax]);
+        result.upper[ax] = std::min(a.upper[ax], b.upper[ax]);
+    }
+    return result;
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * Bound the two sides of a surface.
+ *
+ * The "region" is the positive (outside) sense, which is pushed as "true" by
+ * the logic evaluator, and the "complement" is the negative (inside) sense.
+ */
+LogicBoxes calc_surface_boxes(const Surfaces& surfaces, SurfaceId sid)
+{
+    LogicBoxes result{infinite_bbox(), infinite_bbox()};
+
+    auto bound_plane = [&result](size_type ax, real_type position) {
+        result.complement.upper[ax] = position;
+        result.region.lower[ax]     = position;
+    };
+    auto bound_cyl = [&result](size_type ax, real_type radius_sq) {
+        const real_type radius = std::sqrt(radius_sq);
+        for (auto other : range(size_type(3)))
+        {
+            if (other == ax)
+                continue;
+            result.complement.lower[other] = -radius;
+            result.complement.upper[other] = radius;
+        }
+    };
+
+    switch (surfaces.surface_type(sid))
+    {
+        case SurfaceType::px:
+            bound_plane(0, surfaces.make_surface<PlaneX>(sid).position());
+            break;
+        case SurfaceType::py:
+            bound_plane(1, surfaces.make_surface<PlaneY>(sid).position());
+            break;
+        case SurfaceType::pz:
+            bound_plane(2, surfaces.make_surface<PlaneZ>(sid).position());
+            break;
+        case SurfaceType::cxc:
+            bound_cyl(0, surfaces.make_surface<CCylX>(sid).radius_sq());
+            break;
+        case SurfaceType::cyc:
+            bound_cyl(1, surfaces.make_surface<CCylY>(sid).radius_sq());
+            break;
+        case SurfaceType::czc:
+            bound_cyl(2, surfaces.make_surface<CCylZ>(sid).radius_sq());
+            break;
+        case SurfaceType::s: {
+            const Sphere    sphere = surfaces.make_surface<Sphere>(sid);
+            const real_type radius = std::sqrt(sphere.radius_sq());
+            for (auto ax : range(3))
+            {
+                result.complement.lower[ax] = sphere.origin()[ax] - radius;
+                result.complement.upper[ax] = sphere.origin()[ax] + radius;
+            }
+            break;
+        }
+        default:
+            // General quadrics are unbounded on both sides
+            break;
+    }
+    return result;
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * Calculate a conservative bounding box for a volume.
+ */
+BoundingBox calc_bbox(const Surfaces&          surfaces,
+                      Span<const SurfaceId>    faces,
+                      Span<const logic_int>    logic,
+                      std::vector<LogicBoxes>* stack)
+{
+    stack->clear();
+    for (logic_int lgc : logic)
+    {
+        if (!logic::is_operator_token(lgc))
+        {
+            CELER_ASSERT(lgc < faces.size());
+            stack->push_back(calc_surface_boxes(surfaces, faces[lgc]));
+            continue;
+        }
+        if (lgc == logic::ltrue)
+        {
+            stack->push_back({infinite_bbox(), empty_bbox()});
+            continue;
+        }
+        if (lgc == logic::lnot)
+        {
+            CELER_ASSERT(!stack->empty());
+            std::swap(stack->back().region, stack->back().complement);
+            continue;
+        }
+
+        CELER_ASSERT(stack->size() >= 2);
+        LogicBoxes rhs = stack->back();
+        stack->pop_back();
+        LogicBoxes& lhs = stack->back();
+        if (lgc == logic::land)
+        {
+            lhs.region     = calc_intersection(lhs.region, rhs.region);
+            lhs.complement = calc_union(lhs.complement, rhs.complement);
+        }
+        else
+        {
+            CELER_ASSERT(lgc == logic::lor);
+            lhs.region     = calc_union(lhs.region, rhs.region);
+            lhs.complement = calc_intersection(lhs.complement, rhs.complement);
+        }
+    }
+    CELER_ASSERT(stack->size() == 1);
+    return stack->back().region;
+}
+
+//---------------------------------------------------------------------------//
+} // namespace
+
+//---------------------------------------------------------------------------//
+/*!
+ * Construct with a reference to empty grid data.
+ */
+VolumeGridBuilder::VolumeGridBuilder(Data* grid) : grid_data_(grid)
+{
+    CELER_EXPECT(grid_data_ && !*grid_data_);
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * Calculate bounding boxes and build the grid.
+ */
+void VolumeGridBuilder::operator()(const SurfaceDataRef& surface_data,
+                                   const VolumeDataRef&  volumes)
+{
+    CELER_EXPECT(volumes);
+
+    // Calculate bounding boxes and the extents of the bounded volumes
+    const Surfaces           surfaces(surface_data);
+    std::vector<BoundingBox> bboxes(volumes.size());
+    std::vector<LogicBoxes>  stack;
+    BoundingBox              extents     = empty_bbox();
+    size_type                num_bounded = 0;
+    for (auto vol_id : range(VolumeId{volumes.size()}))
+    {
+        const VolumeDef& def  = volumes.defs[vol_id];
+        BoundingBox&     bbox = bboxes[vol_id.get()];
+        bbox                  = calc_bbox(surfaces,
+                         volumes.faces[def.faces],
+                         volumes.logic[def.logic],
+                         &stack);
+        if (is_finite(bbox))
+        {
+            extents = calc_union(extents, bbox);
+            ++num_bounded;
+        }
+    }
+    if (num_bounded == 0)
+    {
+        // No volumes are bounded: the grid would not reduce the search
+        return;
+    }
+
+    // Choose cells that are close to cubic with about one bounded volume each
+    Real3     width;
+    real_type max_width = 0;
+    real_type grid_vol  = 1;
+    for (auto ax : range(3))
+    {
+        width[ax] = extents.upper[ax] - extents.lower[ax];
+        max_width = std::max(max_width, width[ax]);
+        grid_vol *= width[ax];
+    }
+    const real_type cell_width
+        = grid_vol > 0 ? std::cbrt(grid_vol / num_bounded)
+                       : max_width / num_bounded;
+
+    VolumeGridData<Ownership::value, MemSpace::host>::Size3 dims;
+    Real3                                                   delta;
+    for (auto ax : range(3))
+    {
+        real_type num_cells = cell_width > 0 ? width[ax] / cell_width : 1;
+        dims[ax]            = static_cast<size_type>(
+            std::min<real_type>(std::max<real_type>(std::round(num_cells), 1),
+                                max_dims()));
+        delta[ax] = width[ax] > 0 ? width[ax] / dims[ax] : 1;
+    }
+
+    // Find the range of cells along one axis that overlap a box
+    auto calc_cell_range = [&](const BoundingBox& bbox, size_type ax) {
+        real_type lower = std::max(bbox.lower[ax], extents.lower[ax]);
+        real_type upper = std::min(bbox.upper[ax], extents.upper[ax]);
+        real_type first = std::floor((lower - extents.lower[ax]) / delta[ax]);
+        real_type last
+            = std::ceil((upper - extents.lower[ax]) / delta[ax]) - 1;
+        const real_type max_idx = dims[ax] - 1;
+        first = std::min(std::max<real_type>(first, 0), max_idx);
+        last  = std::min(std::max<real_type>(last, first), max_idx);
+        return range(static_cast<size_type>(first),
+                     static_cast<size_type>(last) + 1);
+    };
+
+    // Add each volume to the cells its box overlaps
+    std::vector<std::vector<VolumeId>> cells(dims[0] * dims[1] * dims[2]);
+    std::vector<VolumeId>              exterior;
+    for (auto vol_id : range(VolumeId{volumes.size()}))
+    {
+        const BoundingBox& bbox = bboxes[vol_id.get()];
+        if (is_empty(calc_intersection(bbox, extents)))
+        {
+            if (!is_empty(bbox))
+            {
+                exterior.push_back(vol_id);
+            }
+            continue;
+        }
+        if (!is_within(bbox, extents))
+        {
+            exterior.push_back(vol_id);
+        }
+
+        for (auto i : calc_cell_range(bbox, 0))
+        {
+            for (auto j : calc_cell_range(bbox, 1))
+            {
+                for (auto k : calc_cell_range(bbox, 2))
+                {
+                    cells[(i * dims[1] + j) * dims[2] + k].push_back(vol_id);
+                }
+            }
+        }
+    }
+
+    // Store
+    make_builder(&grid_data_->bboxes).insert_back(bboxes.begin(),
+                                                  bboxes.end());
+    grid_data_->extents = extents;
+    grid_data_->dims    = dims;
+    grid_data_->delta   = delta;
+
+    auto volume_ids = make_builder(&grid_data_->volumes);
+    auto cell_data  = make_builder(&grid_data_->cells);
+    grid_data_->exterior
+        = volume_ids.insert_back(exterior.begin(), exterior.end());
+    cell_data.reserve(cells.size());
+    for (const auto& cell : cells)
+    {
+        cell_data.push_back(volume_ids.insert_back(cell.begin(), cell.end()));
+    }
+
+    CELER_ENSURE(*grid_data_);
+}
+
+//---------------------------------------------------------------------------//
+} // namespace celeritas
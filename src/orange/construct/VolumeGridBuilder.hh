@@ -0,0 +1,62 @@
+//----------------------------------*-C++-*----------------------------------//
+// Copyright 2021 UT-Battelle, LLC, and other Celeritas developers.
+// See the top-level COPYRIGHT file for details.
+// SPDX-License-Identifier: (Apache-2.0 OR MIT)
+//---------------------------------------------------------------------------//
+//! \file VolumeGridBuilder.hh
+//---------------------------------------------------------------------------//
+#pragma once
+
+#include "../Data.hh"
+
+namespace celeritas
+{
+//---------------------------------------------------------------------------//
+/*!
+ * Construct the point location grid on the host.
+ *
+ * The bounding box of each volume is calculated by evaluating its logic
+ * expression on boxes instead of senses. Aligned planes, centered cylinders,
+ * and spheres bound the "inside" of their surfaces; general quadrics are
+ * treated as unbounded. Each intermediate expression keeps a bound on both
+ * the region and its complement so that negated subexpressions are handled
+ * with De Morgan's laws. The resulting boxes are conservative but not
+ * necessarily tight.
+ *
+ * The grid covers the union of the finite boxes with roughly one cell per
+ * bounded volume. No grid is built if no volume is bounded.
+ *
+ * \code
+   VolumeGridBuilder build_grid(&params.volume_grid);
+   build_grid(surface_ref, volume_ref);
+   \endcode
+ */
+class VolumeGridBuilder
+{
+  public:
+    //!@{
+    //! Type aliases
+    using Data = VolumeGridData<Ownership::value, MemSpace::host>;
+    using SurfaceDataRef
+        = SurfaceData<Ownership::const_reference, MemSpace::host>;
+    using VolumeDataRef
+        = VolumeData<Ownership::const_reference, MemSpace::host>;
+    //!@}
+
+  public:
+    // Construct with reference to the grid to build
+    explicit VolumeGridBuilder(Data* grid);
+
+    // Calculate bounding boxes and build the grid
+    void operator()(const SurfaceDataRef& surfaces,
+                    const VolumeDataRef&  volumes);
+
+    //! Maximum number of grid cells along an axis
+    static constexpr size_type max_dims() { return 128; }
+
+  private:
+    Data* grid_data_{nullptr};
+};
+
+//---------------------------------------------------------------------------//
+} // namespace celeritas
@@ -44,7 +44,23 @@ class SimpleUnitTracker
     inline CELER_FUNCTION Initialization initialize(LocalState state) const;
 
   private:
+    //! Volumes to test based on their bounding boxes
+    enum class BBoxCheck
+    {
+        none,   //!< Test all volumes
+        inside, //!< Test only volumes whose bounding box contains the point
+        outside //!< Test only volumes whose bounding box excludes the point
+    };
+
     const ParamsRef& params_;
+
+    // Find the first of the given volumes that contains the point
+    template<class VolumeIds>
+    inline CELER_FUNCTION Initialization
+    find_volume(const LocalState&        state,
+                detail::SenseCalculator& calc_senses,
+                const VolumeIds&         volumes,
+                BBoxCheck                check_bbox) const;
 };
 
 //---------------------------------------------------------------------------//
@@ -69,6 +85,18 @@ CELER_FUNCTION SimpleUnitTracker::SimpleUnitTracker(const ParamsRef& params)
  *
  * This function is valid for initialization from a point, *and* for
  * initialization across a boundary.
+ *
+ * When crossing a surface, the volumes bounded by that surface are tested
+ * first if the connectivity is present, since the volumes in this unit are
+ * exactly defined by their faces. If the volume grid is also present, the
+ * neighbors whose bounding boxes contain the point are tested before the
+ * rest. If no neighbor contains the point (e.g. due to roundoff near another
+ * surface), the search continues as though initializing from a point.
+ *
+ * Otherwise, if the volume grid is present, only the volumes listed in the
+ * point's grid cell whose bounding boxes contain the point are tested. If none
+ * of them match (e.g. due to roundoff at a boundary), all volumes are
+ * searched.
  */
 CELER_FUNCTION auto SimpleUnitTracker::initialize(LocalState state) const
     -> Initialization
@@ -78,13 +106,72 @@ CELER_FUNCTION auto SimpleUnitTracker::initialize(LocalState state) const
     detail::SenseCalculator calc_senses(
         Surfaces{params_.surfaces}, state.pos, state.temp_senses);
 
-    for (VolumeId volid : range(VolumeId{params_.volumes.size()}))
+    if (state.surface && params_.connectivity)
+    {
+        const auto& conn = params_.connectivity;
+        auto neighbors = conn.volumes[conn.neighbors[state.surface.id()]];
+        if (params_.volume_grid)
+        {
+            if (auto init = this->find_volume(
+                    state, calc_senses, neighbors, BBoxCheck::inside))
+            {
+                return init;
+            }
+            if (auto init = this->find_volume(
+                    state, calc_senses, neighbors, BBoxCheck::outside))
+            {
+                return init;
+            }
+        }
+        else if (auto init = this->find_volume(
+                     state, calc_senses, neighbors, BBoxCheck::none))
+        {
+            return init;
+        }
+    }
+
+    if (params_.volume_grid)
+    {
+        auto candidates
+            = detail::find_candidates(params_.volume_grid, state.pos);
+        if (auto init = this->find_volume(
+                state, calc_senses, candidates, BBoxCheck::inside))
+        {
+            return init;
+        }
+    }
+
+    return this->find_volume(state,
+                             calc_senses,
+                             range(VolumeId{params_.volumes.size()}),
+                             BBoxCheck::none);
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * Find the first of the given volumes that contains the point.
+ */
+template<class VolumeIds>
+CELER_FUNCTION auto
+SimpleUnitTracker::find_volume(const LocalState&        state,
+                               detail::SenseCalculator& calc_senses,
+                               const VolumeIds&         volumes,
+                               BBoxCheck check_bbox) const -> Initialization
+{
+    for (VolumeId volid : volumes)
     {
         if (state.surface && volid == state.volume)
         {
             // Cannot cross surface into the same cell
             continue;
         }
+        if (check_bbox != BBoxCheck::none
+            && detail::is_inside(params_.volume_grid.bboxes[volid], state.pos)
+                   != (check_bbox == BBoxCheck::inside))
+        {
+            // Point can't be inside this cell, or it was already tested
+            continue;
+        }
 
         VolumeView vol{params_.volumes, volid};
 
@@ -7,7 +7,10 @@
 //---------------------------------------------------------------------------//
 #pragma once
 
+#include "base/Algorithms.hh"
 #include "base/Macros.hh"
+#include "base/Range.hh"
+#include "orange/Data.hh"
 #include "Types.hh"
 #include "../VolumeView.hh"
 
@@ -34,6 +37,50 @@ inline CELER_FUNCTION OnSurface get_surface(const VolumeView& vol, OnFace face)
             face.unchecked_sense()};
 }
 
+//---------------------------------------------------------------------------//
+/*!
+ * Whether a point is inside a bounding box, including its boundary.
+ */
+inline CELER_FUNCTION bool is_inside(const BoundingBox& bbox, const Real3& pos)
+{
+    for (auto ax : range(3))
+    {
+        if (!(pos[ax] >= bbox.lower[ax] && pos[ax] <= bbox.upper[ax]))
+            return false;
+    }
+    return true;
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * Find the volumes that may contain a point using the volume grid.
+ *
+ * Points outside the grid can only be in the exterior volumes.
+ */
+inline CELER_FUNCTION Span<const VolumeId> find_candidates(
+    const VolumeGridData<Ownership::const_reference, MemSpace::native>& grid,
+    const Real3&                                                        pos)
+{
+    CELER_EXPECT(grid);
+
+    if (!is_inside(grid.extents, pos))
+    {
+        return grid.volumes[grid.exterior];
+    }
+
+    size_type cell = 0;
+    for (auto ax : range(3))
+    {
+        auto idx = static_cast<size_type>((pos[ax] - grid.extents.lower[ax])
+                                          / grid.delta[ax]);
+        // Points on the upper edge belong to the last cell
+        idx  = min(idx, grid.dims[ax] - 1);
+        cell = cell * grid.dims[ax] + idx;
+    }
+    CELER_ASSERT(cell < grid.cells.size());
+    return grid.volumes[grid.cells[ItemId<ItemRange<VolumeId>>{cell}]];
+}
+
 //---------------------------------------------------------------------------//
 } // namespace detail
 } // namespace celeritas
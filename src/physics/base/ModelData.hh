@@ -41,6 +41,7 @@ struct ModelInteractParamsRefs
     ParamsCRef<PhysicsParamsData>     physics;
     ParamsCRef<CutoffParamsData>      cutoffs;
     ParamsCRef<AtomicRelaxParamsData> relaxation;
+    ParamsCRef<RngParamsData>         rng;
 
     //// METHODS ////
 
@@ -112,15 +113,35 @@ struct ModelInteractStateRefs
 //---------------------------------------------------------------------------//
 /*!
  * All data needed to interact with a model.
+ *
+ * If \c thread_ids is assigned, the interaction kernel visits only the listed
+ * track slots (e.g. the tracks that selected this model, obtained by sorting
+ * the states by model ID) rather than every slot in the state vector.
  */
 template<MemSpace M>
 struct ModelInteractRef
 {
     ModelInteractParamsRefs<M> params;
     ModelInteractStateRefs<M>  states;
+    //! Track slots to visit. An empty span is a sentinel for "all slots", so
+    //! a launcher with an empty subset must skip the launch instead.
+    Span<const ThreadId>       thread_ids;
 
     //! True if assigned
     CELER_FUNCTION operator bool() const { return params && states; }
+
+    //! Number of kernel threads to launch
+    CELER_FUNCTION size_type num_threads() const
+    {
+        return thread_ids.empty() ? states.size() : thread_ids.size();
+    }
+
+    //! Track slot to be processed by the given kernel thread
+    CELER_FUNCTION ThreadId track_slot(ThreadId tid) const
+    {
+        CELER_EXPECT(tid < this->num_threads());
+        return thread_ids.empty() ? tid : thread_ids[tid.get()];
+    }
 };
 
 //---------------------------------------------------------------------------//
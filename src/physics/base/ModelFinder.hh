@@ -0,0 +1,90 @@
+//----------------------------------*-C++-*----------------------------------//
+// Copyright 2021 UT-Battelle, LLC, and other Celeritas developers.
+// See the top-level COPYRIGHT file for details.
+// SPDX-License-Identifier: (Apache-2.0 OR MIT)
+//---------------------------------------------------------------------------//
+//! \file ModelFinder.hh
+//---------------------------------------------------------------------------//
+#pragma once
+
+#include "base/Macros.hh"
+#include "base/Span.hh"
+#include "base/Types.hh"
+#include "physics/grid/EnergyLookupCache.hh"
+#include "physics/grid/UniformGridData.hh"
+#include "Types.hh"
+#include "Units.hh"
+
+namespace celeritas
+{
+//---------------------------------------------------------------------------//
+/*!
+ * Find the model that applies to a particle-process at a given energy.
+ *
+ * The models of a process are stored as a grid of energy bounds with one
+ * model per cell, like \c GridIdFinder. Instead of searching the bounds, the
+ * model is found by indexing a uniform log-energy lookup grid whose bins
+ * store the model at their lower edge. The lookup grid is usually the
+ * process's cross section grid, so when the energy location is taken from an
+ * \c EnergyLookupCache the bin from the cross section calculation is reused
+ * and no additional log or search is needed. A bin can straddle at most a
+ * few model boundaries, which are resolved by comparing against the adjacent
+ * bounds.
+ *
+ * Energies outside the model bounds return a null model. Bound points are
+ * attached to the model above them except for the last.
+ *
+ * \code
+    ModelFinder find_model = physics.make_model_finder(ppid);
+    ModelId applicable_model = find_model(particle.energy());
+   \endcode
+ */
+class ModelFinder
+{
+  public:
+    //!@{
+    //! Type aliases
+    using Energy         = units::MevEnergy;
+    using SpanConstReal  = Span<const real_type>;
+    using SpanConstModel = Span<const ModelId>;
+    using SpanConstIndex = Span<const size_type>;
+    //!@}
+
+  public:
+    // Construct from model bounds and an optional lookup grid
+    inline CELER_FUNCTION ModelFinder(SpanConstReal          energy,
+                                      SpanConstModel         models,
+                                      const UniformGridData& lookup_grid,
+                                      SpanConstIndex         lookup);
+
+    // Find the model at the given energy
+    inline CELER_FUNCTION ModelId operator()(Energy energy) const;
+
+    // Find the model using a cached energy location
+    inline CELER_FUNCTION ModelId operator()(EnergyLookupCache& cache) const;
+
+  private:
+    SpanConstReal   energy_;
+    SpanConstModel  models_;
+    UniformGridData lookup_grid_;
+    SpanConstIndex  lookup_;
+
+    //// HELPER FUNCTIONS ////
+
+    // Whether the energy is inside the model bounds
+    inline CELER_FUNCTION bool in_bounds(real_type energy) const;
+
+    // Calculate the lookup bin from the log energy
+    inline CELER_FUNCTION size_type find_bin(real_type log_energy) const;
+
+    // Find the model starting from the model of a lookup bin
+    inline CELER_FUNCTION ModelId find(real_type energy, size_type bin) const;
+
+    // Find the model by searching the model bounds
+    inline CELER_FUNCTION ModelId search(real_type energy) const;
+};
+
+//---------------------------------------------------------------------------//
+} // namespace celeritas
+
+#include "ModelFinder.i.hh"
@@ -0,0 +1,144 @@
+//----------------------------------*-C++-*----------------------------------//
+// Copyright 2021 UT-Battelle, LLC, and other Celeritas developers.
+// See the top-level COPYRIGHT file for details.
+// SPDX-License-Identifier: (Apache-2.0 OR MIT)
+//---------------------------------------------------------------------------//
+//! \file ModelFinder.i.hh
+//---------------------------------------------------------------------------//
+#include <cmath>
+
+#include "base/Assert.hh"
+#include "physics/grid/GridIdFinder.hh"
+
+namespace celeritas
+{
+//---------------------------------------------------------------------------//
+/*!
+ * Construct from model bounds and an optional lookup grid.
+ *
+ * If the lookup grid is unassigned, the model bounds are searched instead.
+ */
+CELER_FUNCTION
+ModelFinder::ModelFinder(SpanConstReal          energy,
+                         SpanConstModel         models,
+                         const UniformGridData& lookup_grid,
+                         SpanConstIndex         lookup)
+    : energy_(energy)
+    , models_(models)
+    , lookup_grid_(lookup_grid)
+    , lookup_(lookup)
+{
+    CELER_EXPECT(energy_.size() == models_.size() + 1);
+    CELER_EXPECT(!lookup_grid_ || lookup_.size() + 1 == lookup_grid_.size);
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * Find the model at the given energy.
+ */
+CELER_FUNCTION ModelId ModelFinder::operator()(Energy energy) const
+{
+    if (!lookup_grid_)
+    {
+        return this->search(energy.value());
+    }
+    if (!this->in_bounds(energy.value()))
+    {
+        return {};
+    }
+    return this->find(energy.value(),
+                      this->find_bin(std::log(energy.value())));
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * Find the model using a cached energy location.
+ *
+ * The lookup grid always spans the model bounds, so the cache can be queried
+ * for any energy inside them except the endpoint of the grid.
+ */
+CELER_FUNCTION ModelId ModelFinder::operator()(EnergyLookupCache& cache) const
+{
+    const real_type energy = cache.energy().value();
+    if (!lookup_grid_)
+    {
+        return this->search(energy);
+    }
+    if (!this->in_bounds(energy))
+    {
+        return {};
+    }
+
+    size_type bin;
+    if (cache.log_energy() >= lookup_grid_.front
+        && cache.log_energy() < lookup_grid_.back)
+    {
+        bin = cache.find(lookup_grid_).index;
+    }
+    else
+    {
+        bin = this->find_bin(cache.log_energy());
+    }
+    return this->find(energy, bin);
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * Whether the energy is inside the model bounds.
+ */
+CELER_FUNCTION bool ModelFinder::in_bounds(real_type energy) const
+{
+    return energy >= energy_.front() && energy <= energy_.back();
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * Calculate the lookup bin from the log energy, clamping to the grid.
+ */
+CELER_FUNCTION size_type ModelFinder::find_bin(real_type log_energy) const
+{
+    const size_type num_bins = lookup_grid_.size - 1;
+    if (!(log_energy > lookup_grid_.front))
+    {
+        return 0;
+    }
+    auto bin = static_cast<size_type>((log_energy - lookup_grid_.front)
+                                      / lookup_grid_.delta);
+    return bin < num_bins ? bin : num_bins - 1;
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * Find the model starting from the model at the lower edge of a lookup bin.
+ *
+ * Roundoff in the bin calculation or a bin that straddles model boundaries
+ * is corrected by stepping across the adjacent bounds.
+ */
+CELER_FUNCTION ModelId ModelFinder::find(real_type energy, size_type bin) const
+{
+    CELER_EXPECT(bin < lookup_.size());
+    size_type idx = lookup_[bin];
+    CELER_ASSERT(idx < models_.size());
+    while (idx + 1 < models_.size() && energy >= energy_[idx + 1])
+    {
+        ++idx;
+    }
+    while (idx > 0 && energy < energy_[idx])
+    {
+        --idx;
+    }
+    return models_[idx];
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * Find the model by searching the model bounds.
+ */
+CELER_FUNCTION ModelId ModelFinder::search(real_type energy) const
+{
+    GridIdFinder<Energy, ModelId> find_model(energy_, models_);
+    return find_model(Energy{energy});
+}
+
+//---------------------------------------------------------------------------//
+} // namespace celeritas
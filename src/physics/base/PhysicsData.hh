@@ -15,6 +15,7 @@
 #include "physics/em/detail/EPlusGGInteractor.hh"
 #include "physics/em/detail/LivermorePEMicroXsCalculator.hh"
 #include "physics/em/FluctuationData.hh"
+#include "physics/grid/UniformGridData.hh"
 #include "physics/grid/ValueGridData.hh"
 #include "physics/grid/XsGridData.hh"
 #include "physics/material/Types.hh"
@@ -39,13 +40,20 @@ using ValueTableId = OpaqueId<struct ValueTable>;
  * models as a function of energy. The ModelGroup represents this with an
  * energy grid, and each cell of the grid corresponding to a particular
  * ModelId.
+ *
+ * Groups with more than one model also have a uniform log-energy lookup grid
+ * spanning the energy bounds, which is usually the grid of the process's
+ * cross section table. Each lookup bin stores the index of the model at its
+ * lower edge so that the model can be found without a search.
  */
 struct ModelGroup
 {
     using Energy = units::MevEnergy;
 
-    ItemRange<real_type> energy; //!< Energy grid bounds [MeV]
-    ItemRange<ModelId>   model;  //!< Corresponding models
+    ItemRange<real_type> energy;       //!< Energy grid bounds [MeV]
+    ItemRange<ModelId>   model;        //!< Corresponding models
+    UniformGridData      lookup_grid;  //!< Log energy grid for model lookup
+    ItemRange<size_type> lookup_model; //!< Model index for each lookup bin
 
     //! True if assigned
     explicit CELER_FUNCTION operator bool() const
@@ -78,18 +86,17 @@ struct ValueTable
  * This is needed for the integral approach for correctly sampling the discrete
  * interaction length after a particle loses energy along a step. An \c
  * IntegralXsProcess is stored for each particle-process. This will be "false"
- * (i.e. no energy_max assigned) if the process is not continuous-discrete or
- * if \c use_integral_xs is false.
+ * (i.e. no max_xs table assigned) if the process is not continuous-discrete
+ * or if \c use_integral_xs is false. The \c max_xs table is an upper bound on
+ * the largest cross section over the energy range \f$ [\xi E, E] \f$ of a
+ * step, tabulated on a refinement of the cross section grid.
  */
 struct IntegralXsProcess
 {
-    ItemRange<real_type> energy_max_xs; //!< Energy of the largest xs [mat]
+    ValueTableId max_xs; //!< Max xs over the step [mat]
 
     //! True if assigned
-    explicit CELER_FUNCTION operator bool() const
-    {
-        return !energy_max_xs.empty();
-    }
+    explicit CELER_FUNCTION operator bool() const { return bool(max_xs); }
 };
 
 //---------------------------------------------------------------------------//
@@ -103,7 +110,8 @@ struct IntegralXsProcess
  * be \code tables[ValueGridType::macro_xs][2] \endcode. This
  * awkward access is encapsulated by the PhysicsTrackView. \c integral_xs will
  * only be assigned if the integral approach is used and the particle has
- * continuous-discrete processes.
+ * continuous-discrete processes. \c total_xs is only assigned if the summed
+ * cross section tables are enabled.
  */
 struct ProcessGroup
 {
@@ -112,6 +120,7 @@ struct ProcessGroup
     ItemRange<IntegralXsProcess>          integral_xs; //!< [ppid]
     ItemRange<ModelGroup> models;       //!< Model applicability [ppid]
     ParticleProcessId eloss_ppid{}; //!< Process with de/dx and range tables
+    ValueTableId      total_xs{};   //!< Upper bound of tabulated macro xs
 
     //! True if assigned and valid
     explicit CELER_FUNCTION operator bool() const
@@ -196,7 +205,9 @@ struct PhysicsParamsData
 
     // Backend storage
     Items<real_type>            reals;
+    Items<table_real_type>      grid_values;
     Items<ModelId>              model_ids;
+    Items<size_type>            model_indices;
     Items<ValueGrid>            value_grids;
     Items<ValueGridId>          value_grid_ids;
     Items<ProcessId>            process_ids;
@@ -235,7 +246,9 @@ struct PhysicsParamsData
         CELER_EXPECT(other);
 
         reals          = other.reals;
+        grid_values    = other.grid_values;
         model_ids      = other.model_ids;
+        model_indices  = other.model_indices;
         value_grids    = other.value_grids;
         value_grid_ids = other.value_grid_ids;
         process_ids    = other.process_ids;
@@ -266,6 +279,9 @@ struct PhysicsParamsData
  *
  * - Remaining number of mean free paths to the next discrete interaction
  * - Maximum step length (limited by range, energy loss, and interaction)
+ * - Total cross section and the pre-step energy at which it was calculated
+ * - Pre-step energy loss rate and range of the energy loss process, which are
+ *   reused when calculating the energy loss over the step
  * - Selected model ID if undergoing an interaction
  */
 struct PhysicsTrackState
@@ -273,6 +289,9 @@ struct PhysicsTrackState
     real_type interaction_mfp; //!< Remaining MFP to interaction
     real_type step_length;     //!< Overall physics step length
     real_type macro_xs;        //!< Total cross section
+    real_type macro_xs_energy; //!< Energy at which macro_xs was calculated
+    real_type eloss_rate;      //!< Pre-step energy loss rate [MeV/cm]
+    real_type eloss_range;     //!< Pre-step range of the eloss process [cm]
 
     ModelId            model_id;   //!< Selected model if interacting
     ElementComponentId element_id; //!< Selected element during interaction
@@ -7,23 +7,208 @@
 //---------------------------------------------------------------------------//
 #include "PhysicsParams.hh"
 
+#include "celeritas_config.h"
 #include <algorithm>
+#include <cmath>
+#include <exception>
+#include <fstream>
+#include <limits>
 #include <map>
 #include <tuple>
 #include "base/Algorithms.hh"
 #include "base/Assert.hh"
+#include "base/BinaryArchive.hh"
 #include "base/Range.hh"
+#include "base/Stopwatch.hh"
 #include "base/VectorUtils.hh"
 #include "comm/Logger.hh"
+#include "CutoffParams.hh"
+#include "ImportedProcessAdapter.hh"
 #include "ParticleParams.hh"
 #include "physics/em/EPlusGGModel.hh"
 #include "physics/em/LivermorePEModel.hh"
+#include "physics/grid/UniformGrid.hh"
 #include "physics/grid/ValueGridInserter.hh"
 #include "physics/grid/XsCalculator.hh"
 #include "physics/material/MaterialParams.hh"
 
 namespace celeritas
 {
+namespace
+{
+//---------------------------------------------------------------------------//
+/*!
+ * Calculate the maximum of a tabulated cross section over an energy interval.
+ *
+ * The interpolated cross section is monotonic between grid points and
+ * constant outside the grid, so the maximum is at one of the interval
+ * endpoints or at a grid point inside the interval.
+ */
+real_type calc_max_xs(const XsCalculator&    calc_xs,
+                      const UniformGridData& grid_data,
+                      real_type              lower,
+                      real_type              upper)
+{
+    using Energy = XsCalculator::Energy;
+    CELER_EXPECT(lower > 0 && lower <= upper);
+
+    real_type result = std::max(calc_xs(Energy{lower}), calc_xs(Energy{upper}));
+
+    const UniformGrid loge_grid(grid_data);
+    const real_type   log_lower = std::log(lower);
+    const real_type   log_upper = std::log(upper);
+    if (log_upper > loge_grid.front() && log_lower < loge_grid.back())
+    {
+        size_type i = log_lower < loge_grid.front()
+                          ? 0
+                          : loge_grid.find(log_lower) + 1;
+        for (; i < loge_grid.size() && loge_grid[i] < log_upper; ++i)
+        {
+            result = std::max(result, calc_xs[i]);
+        }
+    }
+    return result;
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * Step limit grids built independently for one particle, process, material.
+ */
+struct TempGrids
+{
+    ValueGridInserter::RealCollection   grid_values;
+    ValueGridInserter::XsGridCollection value_grids;
+    ValueGridArray<ValueGridId>         ids;
+    double                              time{0};
+    ValueGridArray<ValueGridInserter::LookupDeviation> deviation;
+};
+
+//---------------------------------------------------------------------------//
+/*!
+ * Insert temporary grids into the physics data, returning their new IDs.
+ */
+ValueGridArray<ValueGridId>
+merge_grids(const TempGrids& temp, ValueGridInserter& insert_grid)
+{
+    ValueGridArray<ValueGridId> result;
+    for (auto vgt : range(ValueGridType::size_))
+    {
+        if (ValueGridId id = temp.ids[vgt])
+        {
+            const XsGridData&      grid = temp.value_grids[id];
+            auto                   temp_values = temp.grid_values[grid.value];
+            std::vector<real_type> values(temp_values.begin(),
+                                          temp_values.end());
+            result[vgt] = insert_grid(
+                grid.log_energy, grid.prime_index, make_span(values));
+        }
+    }
+    return result;
+}
+
+//---------------------------------------------------------------------------//
+//!@{
+//! Physics table cache file identification
+constexpr std::uint32_t cache_magic   = 0x43454c50u;
+constexpr std::uint32_t cache_version = 5;
+//!@}
+
+//---------------------------------------------------------------------------//
+/*!
+ * Read or write the tabulated physics data.
+ */
+template<class Archive, class Data>
+void archive_tables(Archive& ar, Data& data)
+{
+    ar(data.reals)(data.grid_values)(data.model_ids)(data.model_indices);
+    ar(data.value_grids)(data.value_grid_ids);
+    ar(data.process_ids)(data.value_tables)(data.integral_xs);
+    ar(data.model_groups)(data.process_groups);
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * Hash the material properties used to build the physics tables.
+ *
+ * Fields are hashed individually so that struct padding does not change the
+ * key.
+ */
+void hash_materials(const MaterialParams& mats, BinaryWriter& hash)
+{
+    hash(static_cast<std::uint64_t>(mats.size()));
+    for (auto mat_id : range(MaterialId{mats.size()}))
+    {
+        MaterialView mat = mats.get(mat_id);
+        hash(mat.number_density())(mat.temperature())(mat.matter_state());
+        hash(mat.mean_excitation_energy().value());
+        hash(static_cast<std::uint64_t>(mat.num_elements()));
+        for (auto comp_id : range(ElementComponentId{mat.num_elements()}))
+        {
+            ElementView el = mat.element_view(comp_id);
+            hash(el.atomic_number())(el.atomic_mass().value());
+            hash(mat.elements()[comp_id.get()].fraction);
+        }
+    }
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * Hash the production cuts for every material.
+ */
+void hash_cutoffs(const CutoffParams& cutoffs, BinaryWriter& hash)
+{
+    const auto& data = cutoffs.host_ref();
+    hash(static_cast<std::uint64_t>(data.num_particles));
+    hash(static_cast<std::uint64_t>(data.num_materials));
+    hash(data.id_to_index);
+    for (const ParticleCutoff& cut : data.cutoffs[AllItems<ParticleCutoff>{}])
+    {
+        hash(cut.energy.value())(cut.range);
+    }
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * Hash the imported physics tables.
+ */
+void hash_imported(const ImportedProcesses& imported, BinaryWriter& hash)
+{
+    auto hash_values = [&hash](const std::vector<double>& values) {
+        hash(static_cast<std::uint64_t>(values.size()));
+        for (double v : values)
+        {
+            hash(v);
+        }
+    };
+
+    hash(static_cast<std::uint64_t>(imported.size()));
+    for (auto id : range(ImportedProcesses::ImportProcessId{imported.size()}))
+    {
+        const ImportProcess& proc = imported.get(id);
+        hash(proc.particle_pdg)(proc.process_type)(proc.process_class);
+        hash(static_cast<std::uint64_t>(proc.models.size()));
+        for (ImportModelClass model : proc.models)
+        {
+            hash(model);
+        }
+        hash(static_cast<std::uint64_t>(proc.tables.size()));
+        for (const ImportPhysicsTable& table : proc.tables)
+        {
+            hash(table.table_type)(table.x_units)(table.y_units);
+            hash(static_cast<std::uint64_t>(table.physics_vectors.size()));
+            for (const ImportPhysicsVector& vec : table.physics_vectors)
+            {
+                hash(vec.vector_type);
+                hash_values(vec.x);
+                hash_values(vec.y);
+            }
+        }
+    }
+}
+
+//---------------------------------------------------------------------------//
+} // namespace
+
 //---------------------------------------------------------------------------//
 /*!
  * Construct with processes and helper classes.
@@ -36,6 +221,10 @@ PhysicsParams::PhysicsParams(Input inp) : processes_(std::move(inp.processes))
                              [](const SPConstProcess& p) { return bool(p); }));
     CELER_EXPECT(inp.particles);
     CELER_EXPECT(inp.materials);
+    CELER_VALIDATE(inp.cache_file.empty() || (inp.cutoffs && inp.imported),
+                   << "physics table cache '" << inp.cache_file
+                   << "' requires the production cutoffs and imported "
+                      "physics tables to be given as input");
 
     // Emit models for associated proceses
     models_ = this->build_models();
@@ -45,12 +234,33 @@ PhysicsParams::PhysicsParams(Input inp) : processes_(std::move(inp.processes))
     this->build_options(inp.options, &host_data);
     this->build_fluct(inp.options, *inp.materials, *inp.particles, &host_data);
     this->build_ids(*inp.particles, &host_data);
-    this->build_xs(inp.options, *inp.materials, &host_data);
+
+    CacheKey cache_key{};
+    if (!inp.cache_file.empty())
+    {
+        cache_key = this->calc_cache_key(inp, host_data);
+    }
+    if (inp.cache_file.empty()
+        || !this->load_cache(inp.cache_file, cache_key, &host_data))
+    {
+        this->build_xs(inp.options, *inp.materials, &host_data);
+        if (inp.options.total_xs_table)
+        {
+            this->build_total_xs(*inp.materials, &host_data);
+        }
+        this->build_model_lookup(&host_data);
+        if (!inp.cache_file.empty())
+        {
+            this->save_cache(inp.cache_file, cache_key, host_data);
+        }
+    }
 
     CELER_LOG(debug)
         << "Constructed physics sizes:"
         << "\n  reals: " << host_data.reals.size()
+        << "\n  grid_values: " << host_data.grid_values.size()
         << "\n  model_ids: " << host_data.model_ids.size()
+        << "\n  model_indices: " << host_data.model_indices.size()
         << "\n  value_grids: " << host_data.value_grids.size()
         << "\n  value_grid_ids: " << host_data.value_grid_ids.size()
         << "\n  process_ids: " << host_data.process_ids.size()
@@ -266,6 +476,153 @@ void PhysicsParams::build_ids(const ParticleParams& particles,
     CELER_ENSURE(*data);
 }
 
+//---------------------------------------------------------------------------//
+/*!
+ * Construct step limit grids for every particle, process, and material.
+ *
+ * Each grid set is built independently (in parallel when OpenMP is enabled)
+ * into temporary storage, then appended to the physics data in (particle,
+ * process, material) order so that the result does not depend on the number
+ * of threads. The accumulated construction time of each process is reported.
+ */
+auto PhysicsParams::build_grids(const MaterialParams& mats,
+                                HostValue*            data) const -> VecGridIds
+{
+    CELER_EXPECT(*data);
+
+    using UPGridBuilder = Process::UPConstGridBuilder;
+
+    Stopwatch get_time;
+
+    // Enumerate the step limits to construct
+    std::vector<std::pair<ProcessId, Applicability>> tasks;
+    for (auto particle_id : range(ParticleId(data->process_groups.size())))
+    {
+        const auto& process_groups = data->process_groups[particle_id];
+        Span<const ProcessId> processes
+            = data->process_ids[process_groups.processes];
+        Span<const ModelGroup> model_groups
+            = data->model_groups[process_groups.models];
+        CELER_ASSERT(processes.size() == model_groups.size());
+
+        for (auto pp_idx : range(processes.size()))
+        {
+            // Get energy bounds for this process
+            Span<const real_type> energy_grid
+                = data->reals[model_groups[pp_idx].energy];
+            Applicability applic;
+            applic.particle = particle_id;
+            applic.lower    = Applicability::Energy{energy_grid.front()};
+            applic.upper    = Applicability::Energy{energy_grid.back()};
+            CELER_ASSERT(applic.lower < applic.upper);
+
+            for (auto mat_id : range(MaterialId{mats.size()}))
+            {
+                applic.material = mat_id;
+                tasks.push_back({processes[pp_idx], applic});
+            }
+        }
+    }
+
+    // Build grids into separate storage for each task
+    std::vector<TempGrids>          temp(tasks.size());
+    std::vector<std::exception_ptr> errors(tasks.size());
+#pragma omp parallel for schedule(dynamic)
+    for (size_type i = 0; i < tasks.size(); ++i)
+    {
+        try
+        {
+            Stopwatch      get_task_time;
+            const Process& proc = this->process(tasks[i].first);
+
+            // Construct step limit builders
+            auto builders = proc.step_limits(tasks[i].second);
+            CELER_VALIDATE(
+                std::any_of(builders.begin(),
+                            builders.end(),
+                            [](const UPGridBuilder& p) { return bool(p); }),
+                << "process '" << proc.label()
+                << "' has neither interaction nor energy loss (it must "
+                   "have at least one)");
+
+            // Construct grids, recording the precision loss of each type
+            for (auto vgt : range(ValueGridType::size_))
+            {
+                if (builders[vgt])
+                {
+                    ValueGridInserter insert_grid(&temp[i].grid_values,
+                                                  &temp[i].value_grids);
+                    temp[i].ids[vgt] = builders[vgt]->build(insert_grid);
+                    temp[i].deviation[vgt] = insert_grid.max_deviation();
+                }
+            }
+            temp[i].time = get_task_time();
+        }
+        catch (...)
+        {
+            // Exceptions can't propagate out of a parallel region
+            errors[i] = std::current_exception();
+        }
+    }
+
+    for (const auto& error : errors)
+    {
+        if (error)
+        {
+            std::rethrow_exception(error);
+        }
+    }
+
+    // Merge grids in task order, sharing storage between identical grids
+    using Deviation = ValueGridArray<ValueGridInserter::LookupDeviation>;
+    ValueGridInserter      insert_grid(&data->grid_values, &data->value_grids);
+    VecGridIds             result(tasks.size());
+    std::vector<double>    process_time(this->num_processes(), 0);
+    std::vector<Deviation> process_deviation(this->num_processes());
+    for (auto i : range(tasks.size()))
+    {
+        result[i]           = merge_grids(temp[i], insert_grid);
+        const auto proc_idx = tasks[i].first.get();
+        process_time[proc_idx] += temp[i].time;
+        for (auto vgt : range(ValueGridType::size_))
+        {
+            auto&       dst = process_deviation[proc_idx][vgt];
+            const auto& src = temp[i].deviation[vgt];
+            dst.value       = std::max(dst.value, src.value);
+            dst.inverse     = std::max(dst.inverse, src.inverse);
+        }
+        temp[i] = {};
+    }
+
+    CELER_LOG(debug) << "Built " << data->value_grids.size()
+                     << " physics grids for " << tasks.size()
+                     << " particle/process/material combinations in "
+                     << get_time() << " s (saved "
+                     << insert_grid.bytes_saved()
+                     << " bytes by reusing duplicate grids)";
+    for (auto process_id : range(ProcessId{this->num_processes()}))
+    {
+        CELER_LOG(debug) << "Process '" << this->process(process_id).label()
+                         << "' grid construction: "
+                         << process_time[process_id.get()] << " s";
+        if (CELERITAS_SINGLE_PRECISION_TABLES)
+        {
+            const Deviation& dev = process_deviation[process_id.get()];
+            CELER_LOG(debug)
+                << "Process '" << this->process(process_id).label()
+                << "' maximum relative deviation of single-precision "
+                   "lookups: "
+                << dev[ValueGridType::macro_xs].value << " (xs), "
+                << dev[ValueGridType::energy_loss].value << " (dE/dx), "
+                << dev[ValueGridType::range].value << " (range), "
+                << dev[ValueGridType::range].inverse << " (inverse range)";
+        }
+    }
+
+    CELER_ENSURE(result.size() == tasks.size());
+    return result;
+}
+
 //---------------------------------------------------------------------------//
 /*!
  * Construct cross section data.
@@ -276,22 +633,17 @@ void PhysicsParams::build_xs(const Options&        opts,
 {
     CELER_EXPECT(*data);
 
-    using UPGridBuilder = Process::UPConstGridBuilder;
+    // Grid IDs for each particle, process, and material
+    const VecGridIds grid_ids = this->build_grids(mats, data);
+    auto             grid_id_iter = grid_ids.begin();
 
-    ValueGridInserter insert_grid(&data->reals, &data->value_grids);
+    ValueGridInserter insert_grid(&data->grid_values, &data->value_grids);
     auto              value_tables   = make_builder(&data->value_tables);
     auto              integral_xs    = make_builder(&data->integral_xs);
     auto              value_grid_ids = make_builder(&data->value_grid_ids);
-    auto              build_grid
-        = [insert_grid](const UPGridBuilder& builder) -> ValueGridId {
-        return builder ? builder->build(insert_grid) : ValueGridId{};
-    };
 
-    Applicability applic;
     for (auto particle_id : range(ParticleId(data->process_groups.size())))
     {
-        applic.particle = particle_id;
-
         // Processes for this particle
         ProcessGroup& process_groups = data->process_groups[particle_id];
         Span<const ProcessId> processes
@@ -314,13 +666,6 @@ void PhysicsParams::build_xs(const Options&        opts,
         for (auto pp_idx :
              range(ParticleProcessId::size_type(processes.size())))
         {
-            // Get energy bounds for this process
-            Span<const real_type> energy_grid
-                = data->reals[model_groups[pp_idx].energy];
-            applic.lower = Applicability::Energy{energy_grid.front()};
-            applic.upper = Applicability::Energy{energy_grid.back()};
-            CELER_ASSERT(applic.lower < applic.upper);
-
             const Process& proc = this->process(processes[pp_idx]);
 
             // Grid IDs for each grid type, each material
@@ -330,60 +675,87 @@ void PhysicsParams::build_xs(const Options&        opts,
                 vec.resize(mats.size());
             }
 
-            // Energy of maximum cross section for each material
-            std::vector<real_type> energy_max_xs;
+            // Envelope of the maximum cross section over the step for each
+            // material
+            std::vector<ValueGridId> max_xs_grids;
 
             // Loop over materials
             for (auto mat_id : range(MaterialId{mats.size()}))
             {
-                applic.material = mat_id;
-
-                // Construct step limit builders
-                auto builders = proc.step_limits(applic);
-                CELER_VALIDATE(
-                    std::any_of(builders.begin(),
-                                builders.end(),
-                                [](const UPGridBuilder& p) { return bool(p); }),
-                    << "process '" << proc.label()
-                    << "' has neither interaction nor energy loss (it must "
-                       "have at least one)");
-
-                // Construct grids
+                CELER_ASSERT(grid_id_iter != grid_ids.end());
                 for (auto vgt : range(ValueGridType::size_))
                 {
-                    temp_grid_ids[vgt][mat_id.get()]
-                        = build_grid(builders[vgt]);
+                    temp_grid_ids[vgt][mat_id.get()] = (*grid_id_iter)[vgt];
                 }
+                ++grid_id_iter;
 
-                // If this is an energy loss process, find and store the energy
-                // of the largest cross section for this material
+                // If this is an energy loss process, tabulate the envelope of
+                // the largest cross section over a step for this material
                 auto grid_id
                     = temp_grid_ids[ValueGridType::macro_xs][mat_id.get()];
                 if (proc.type() == ProcessType::electromagnetic_dedx
                     && opts.use_integral_xs && grid_id)
                 {
-                    // Allocate storage for the energies if we haven't already
-                    energy_max_xs.resize(mats.size());
+                    // Allocate storage for the grids if we haven't already
+                    max_xs_grids.resize(mats.size());
 
-                    const auto&        grid_data = data->value_grids[grid_id];
+                    const XsGridData   grid_data = data->value_grids[grid_id];
                     auto               data_ref  = make_const_ref(*data);
-                    const UniformGrid  loge_grid(grid_data.log_energy);
-                    const XsCalculator calc_xs(grid_data, data_ref.reals);
+                    const XsCalculator calc_xs(grid_data,
+                                               data_ref.grid_values);
 
-                    // Find the energy of the largest cross section
-                    real_type xs_max = 0;
-                    real_type e_max  = 0;
-                    for (auto i : range(loge_grid.size()))
+                    // Subdivide each cell of the cross section grid so that
+                    // the envelope resolves the step interval [xi E, E]
+                    const UniformGridData& xs_grid = grid_data.log_energy;
+                    const real_type        log_step
+                        = -std::log(data->energy_fraction);
+                    const size_type refine = std::max<size_type>(
+                        1, std::ceil(2 * xs_grid.delta / log_step));
+                    const size_type size = (xs_grid.size - 1) * refine + 1;
+                    const UniformGrid loge_grid(UniformGridData::from_bounds(
+                        xs_grid.front, xs_grid.back, size));
+                    const size_type prime_index
+                        = grid_data.prime_index == XsGridData::no_scaling()
+                              ? XsGridData::no_scaling()
+                              : grid_data.prime_index * refine;
+
+                    std::vector<real_type> energy(size);
+                    for (auto i : range(size))
                     {
-                        real_type xs = calc_xs[i];
-                        if (xs > xs_max)
+                        energy[i] = std::exp(loge_grid[i]);
+                    }
+
+                    // Largest cross section over any step whose pre-step
+                    // energy is in each cell
+                    std::vector<real_type> cell_xs(size - 1);
+                    for (auto i : range(size - 1))
+                    {
+                        cell_xs[i] = calc_max_xs(calc_xs,
+                                                 xs_grid,
+                                                 data->energy_fraction
+                                                     * energy[i],
+                                                 energy[i + 1]);
+                    }
+
+                    // Each point bounds both of its adjacent cells so that
+                    // the interpolated envelope is an upper bound everywhere
+                    // (scaled like the cross section grid)
+                    std::vector<real_type> max_xs(size);
+                    max_xs.front() = cell_xs.front();
+                    max_xs.back()  = cell_xs.back();
+                    for (auto i : range<size_type>(1, size - 1))
+                    {
+                        max_xs[i] = std::max(cell_xs[i - 1], cell_xs[i]);
+                    }
+                    for (auto i : range(size))
+                    {
+                        if (i >= prime_index)
                         {
-                            xs_max = xs;
-                            e_max  = std::exp(loge_grid[i]);
+                            max_xs[i] *= energy[i];
                         }
                     }
-                    CELER_ASSERT(e_max > 0);
-                    energy_max_xs[mat_id.get()] = e_max;
+                    max_xs_grids[mat_id.get()] = insert_grid(
+                        loge_grid.data(), prime_index, make_span(max_xs));
                 }
 
                 // Index of the energy loss process that stores the de/dx and
@@ -419,13 +791,13 @@ void PhysicsParams::build_xs(const Options&        opts,
                 CELER_ASSERT(temp_table.material.size() == mats.size());
             }
 
-            // Store the energies of the maximum cross sections
-            if (!energy_max_xs.empty())
+            // Store the envelope tables
+            if (!max_xs_grids.empty())
             {
-                temp_integral_xs[pp_idx].energy_max_xs
-                    = make_builder(&data->reals)
-                          .insert_back(energy_max_xs.begin(),
-                                       energy_max_xs.end());
+                ValueTable table;
+                table.material = value_grid_ids.insert_back(
+                    max_xs_grids.begin(), max_xs_grids.end());
+                temp_integral_xs[pp_idx].max_xs = value_tables.push_back(table);
             }
         }
 
@@ -440,6 +812,256 @@ void PhysicsParams::build_xs(const Options&        opts,
                 temp_tables[vgt].begin(), temp_tables[vgt].end());
         }
     }
+    CELER_ENSURE(grid_id_iter == grid_ids.end());
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * Construct upper bounds of the summed tabulated cross sections.
+ *
+ * For each particle and material, the sum is tabulated on a uniform log grid
+ * as fine as the finest process grid, extended by one point beyond the process
+ * grids on each end so that the bound is tight where the process tables are
+ * clamped (and exact far below them, e.g. for stopped particles). Each process
+ * is bounded separately over every grid cell, and each grid point stores the
+ * larger of the summed bounds of its two adjacent cells, so that the linearly
+ * interpolated total is never smaller than the true sum. For the integral
+ * approach, the tabulated envelope of the maximum cross section over a step is
+ * bounded instead of the cross section. Hardwired processes are excluded where
+ * their cross sections are calculated on the fly.
+ */
+void PhysicsParams::build_total_xs(const MaterialParams& mats,
+                                   HostValue*            data) const
+{
+    CELER_EXPECT(*data);
+
+    // Tabulated cross section of a single process in a single material
+    struct ProcessXs
+    {
+        ValueGridId grid_id;
+        real_type   min_energy;
+    };
+
+    ValueGridInserter insert_grid(&data->grid_values, &data->value_grids);
+    auto              value_tables   = make_builder(&data->value_tables);
+    auto              value_grid_ids = make_builder(&data->value_grid_ids);
+    const auto&       hardwired      = data->hardwired;
+    size_type         num_points     = 0;
+
+    for (auto particle_id : range(ParticleId(data->process_groups.size())))
+    {
+        ProcessGroup& process_group = data->process_groups[particle_id];
+        Span<const ProcessId> processes
+            = data->process_ids[process_group.processes];
+
+        std::vector<ValueGridId> temp_grid_ids(mats.size());
+        for (auto mat_idx : range(mats.size()))
+        {
+            // Gather the tabulated cross sections for this material
+            std::vector<ProcessXs> process_xs;
+            for (auto pp_idx : range(processes.size()))
+            {
+                if (processes[pp_idx] == hardwired.positron_annihilation)
+                    continue;
+
+                const ValueTable& table = data->value_tables
+                    [process_group.tables[ValueGridType::macro_xs][pp_idx]];
+                if (!table || !table.material[mat_idx])
+                    continue;
+
+                ProcessXs pxs;
+                pxs.grid_id = data->value_grid_ids[table.material[mat_idx]];
+                if (!pxs.grid_id)
+                    continue;
+
+                // Bound the envelope used by the integral approach instead
+                const IntegralXsProcess& integral_xs
+                    = data->integral_xs[process_group.integral_xs[pp_idx]];
+                if (integral_xs.max_xs)
+                {
+                    const ValueTable& max_xs_table
+                        = data->value_tables[integral_xs.max_xs];
+                    if (ValueGridId max_xs_grid = data->value_grid_ids
+                            [max_xs_table.material[mat_idx]])
+                    {
+                        pxs.grid_id = max_xs_grid;
+                    }
+                }
+
+                // Photoelectric cross sections are tabulated above threshold
+                pxs.min_energy
+                    = processes[pp_idx] == hardwired.photoelectric
+                          ? hardwired.photoelectric_table_thresh.value()
+                          : 0;
+                process_xs.push_back(pxs);
+            }
+            if (process_xs.empty())
+                continue;
+
+            // Construct a grid spanning all the process grids
+            real_type front = std::numeric_limits<real_type>::infinity();
+            real_type back  = -front;
+            real_type delta = front;
+            for (const ProcessXs& pxs : process_xs)
+            {
+                const UniformGridData& grid
+                    = data->value_grids[pxs.grid_id].log_energy;
+                front = std::min(front, grid.front);
+                back  = std::max(back, grid.back);
+                delta = std::min(delta, grid.delta);
+            }
+            const size_type size
+                = static_cast<size_type>(std::ceil((back - front) / delta))
+                  + 3;
+            front -= delta;
+            const auto log_grid = UniformGridData::from_bounds(
+                front, front + (size - 1) * delta, size);
+            const UniformGrid loge_grid(log_grid);
+
+            // Bound the sum of the process cross sections on each cell
+            auto                      data_ref = make_const_ref(*data);
+            std::vector<XsCalculator> calculators;
+            for (const ProcessXs& pxs : process_xs)
+            {
+                calculators.emplace_back(data_ref.value_grids[pxs.grid_id],
+                                         data_ref.grid_values);
+            }
+            std::vector<real_type> cell_xs(size - 1, 0);
+            for (auto i : range(size - 1))
+            {
+                const real_type lower = std::exp(loge_grid[i]);
+                const real_type upper = std::exp(loge_grid[i + 1]);
+                for (auto p : range(process_xs.size()))
+                {
+                    const ProcessXs& pxs = process_xs[p];
+                    if (upper < pxs.min_energy)
+                        continue;
+
+                    cell_xs[i] += calc_max_xs(
+                        calculators[p],
+                        data_ref.value_grids[pxs.grid_id].log_energy,
+                        std::max(lower, pxs.min_energy),
+                        upper);
+                }
+            }
+
+            // Each point bounds both of its adjacent cells
+            std::vector<real_type> temp_xs(size);
+            temp_xs.front() = cell_xs.front();
+            temp_xs.back()  = cell_xs.back();
+            for (auto i : range<size_type>(1, size - 1))
+            {
+                temp_xs[i] = std::max(cell_xs[i - 1], cell_xs[i]);
+            }
+            temp_grid_ids[mat_idx] = insert_grid(log_grid, make_span(temp_xs));
+            num_points += size;
+        }
+
+        if (std::any_of(temp_grid_ids.begin(),
+                        temp_grid_ids.end(),
+                        [](ValueGridId id) { return bool(id); }))
+        {
+            ValueTable table;
+            table.material = value_grid_ids.insert_back(temp_grid_ids.begin(),
+                                                        temp_grid_ids.end());
+            process_group.total_xs = value_tables.push_back(table);
+        }
+    }
+
+    CELER_LOG(debug) << "Constructed summed cross section tables with "
+                     << num_points << " total grid points";
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * Construct the direct model lookup for processes with several models.
+ *
+ * The lookup grid is the cross section grid of the process in the first
+ * material if it spans the model energy bounds, so that the energy location
+ * calculated for the cross section can be reused. Otherwise a grid is
+ * constructed whose bins are no wider than the narrowest model, so that each
+ * bin contains at most one model boundary.
+ */
+void PhysicsParams::build_model_lookup(HostValue* data) const
+{
+    CELER_EXPECT(*data);
+
+    constexpr size_type max_bins = 256;
+
+    auto model_indices = make_builder(&data->model_indices);
+
+    for (auto particle_id : range(ParticleId(data->process_groups.size())))
+    {
+        const ProcessGroup& process_group = data->process_groups[particle_id];
+        const ItemRange<ValueTable>& xs_tables
+            = process_group.tables[ValueGridType::macro_xs];
+
+        for (auto pp_idx : range(process_group.models.size()))
+        {
+            ModelGroup& model_group
+                = data->model_groups[process_group.models[pp_idx]];
+            Span<const real_type> bounds = data->reals[model_group.energy];
+            if (bounds.size() <= 2 || !(bounds.front() > 0)
+                || !std::isfinite(bounds.back()))
+            {
+                // A single model or bounds that can't be put on a log grid:
+                // search the bounds instead
+                continue;
+            }
+            const real_type log_lower = std::log(bounds.front());
+            const real_type log_upper = std::log(bounds.back());
+
+            UniformGridData grid;
+            if (!xs_tables.empty())
+            {
+                const ValueTable& table
+                    = data->value_tables[xs_tables[pp_idx]];
+                ValueGridId grid_id
+                    = table ? data->value_grid_ids[table.material[0]]
+                            : ValueGridId{};
+                if (grid_id)
+                {
+                    const UniformGridData& xs_grid
+                        = data->value_grids[grid_id].log_energy;
+                    if (xs_grid.front <= log_lower
+                        && xs_grid.back >= log_upper)
+                    {
+                        grid = xs_grid;
+                    }
+                }
+            }
+            if (!grid)
+            {
+                real_type min_width = log_upper - log_lower;
+                for (auto i : range<size_type>(1, bounds.size()))
+                {
+                    min_width = std::min(min_width,
+                                         std::log(bounds[i])
+                                             - std::log(bounds[i - 1]));
+                }
+                auto num_bins = static_cast<size_type>(
+                    std::ceil((log_upper - log_lower) / min_width));
+                num_bins = std::min(std::max<size_type>(num_bins, 1), max_bins);
+                grid = UniformGridData::from_bounds(
+                    log_lower, log_upper, num_bins + 1);
+            }
+
+            // Store the index of the model at the lower edge of each bin
+            const UniformGrid      loge_grid(grid);
+            std::vector<size_type> indices(loge_grid.size() - 1);
+            for (auto i : range(indices.size()))
+            {
+                auto iter = std::upper_bound(bounds.begin() + 1,
+                                             bounds.end() - 1,
+                                             std::exp(loge_grid[i]));
+                indices[i] = iter - (bounds.begin() + 1);
+            }
+
+            model_group.lookup_grid  = grid;
+            model_group.lookup_model
+                = model_indices.insert_back(indices.begin(), indices.end());
+        }
+    }
 }
 
 //---------------------------------------------------------------------------//
@@ -487,5 +1109,141 @@ void PhysicsParams::build_fluct(const Options&        opts,
     }
 }
 
+//---------------------------------------------------------------------------//
+/*!
+ * Calculate a key identifying the input to the physics tables.
+ *
+ * This must be called after the particle/process/model mappings are built.
+ */
+auto PhysicsParams::calc_cache_key(const Input&     inp,
+                                   const HostValue& data) const -> CacheKey
+{
+    CELER_EXPECT(inp.cutoffs && inp.imported);
+
+    BinaryWriter hash;
+    hash(cache_version)(static_cast<std::uint32_t>(sizeof(real_type)));
+    hash(static_cast<std::uint32_t>(sizeof(table_real_type)));
+
+    const Options& opts = inp.options;
+    hash(opts.min_range)(opts.max_step_over_range)(opts.min_eprime_over_e);
+    hash(opts.linear_loss_limit)(opts.use_integral_xs);
+    hash(opts.enable_fluctuation)(opts.total_xs_table);
+
+    hash_materials(*inp.materials, hash);
+    hash_cutoffs(*inp.cutoffs, hash);
+    hash_imported(*inp.imported, hash);
+
+    for (const SPConstProcess& process : processes_)
+    {
+        const std::string label = process->label();
+        hash(static_cast<std::uint64_t>(label.size()));
+        for (char c : label)
+        {
+            hash(c);
+        }
+    }
+
+    hash(data.reals)(data.model_ids)(data.process_ids);
+    hash(data.model_groups)(data.process_groups);
+    return hash.checksum();
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * Load physics tables from a cache file.
+ *
+ * The tables overwrite the ones in the given data only if the file exists
+ * and matches the key and checksum. Returns whether the tables were loaded.
+ */
+bool PhysicsParams::load_cache(const std::string& filename,
+                               CacheKey           key,
+                               HostValue*         data) const
+{
+    CELER_EXPECT(data);
+
+    std::ifstream infile(filename, std::ios::binary);
+    if (!infile)
+    {
+        CELER_LOG(info) << "Physics table cache '" << filename
+                        << "' does not exist: building tables";
+        return false;
+    }
+
+    Stopwatch get_time;
+    HostValue temp;
+    try
+    {
+        BinaryReader  read(&infile);
+        std::uint32_t magic{};
+        std::uint32_t version{};
+        CacheKey      file_key{};
+        read(magic)(version)(file_key);
+        if (magic != cache_magic || version != cache_version
+            || file_key != key)
+        {
+            CELER_LOG(warning) << "Ignoring physics table cache '" << filename
+                               << "' built from different input";
+            return false;
+        }
+
+        archive_tables(read, temp);
+        const std::uint64_t checksum = read.checksum();
+        std::uint64_t       stored{};
+        read(stored);
+        CELER_VALIDATE(stored == checksum, << "checksum mismatch");
+    }
+    catch (const RuntimeError& e)
+    {
+        CELER_LOG(warning) << "Ignoring corrupt physics table cache '"
+                           << filename << "': " << e.what();
+        return false;
+    }
+
+    data->reals          = std::move(temp.reals);
+    data->grid_values    = std::move(temp.grid_values);
+    data->model_ids      = std::move(temp.model_ids);
+    data->model_indices  = std::move(temp.model_indices);
+    data->value_grids    = std::move(temp.value_grids);
+    data->value_grid_ids = std::move(temp.value_grid_ids);
+    data->process_ids    = std::move(temp.process_ids);
+    data->value_tables   = std::move(temp.value_tables);
+    data->integral_xs    = std::move(temp.integral_xs);
+    data->model_groups   = std::move(temp.model_groups);
+    data->process_groups = std::move(temp.process_groups);
+
+    CELER_LOG(info) << "Loaded physics tables from '" << filename << "' in "
+                    << get_time() << " s";
+    return true;
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * Save physics tables to a cache file.
+ *
+ * Failure to write the cache is not an error.
+ */
+void PhysicsParams::save_cache(const std::string& filename,
+                               CacheKey           key,
+                               const HostValue&   data) const
+{
+    std::ofstream outfile(filename, std::ios::binary | std::ios::trunc);
+    try
+    {
+        CELER_VALIDATE(outfile, << "could not open file");
+
+        BinaryWriter write(&outfile);
+        write(cache_magic)(cache_version)(key);
+        archive_tables(write, data);
+        write(write.checksum());
+    }
+    catch (const RuntimeError& e)
+    {
+        CELER_LOG(warning) << "Failed to write physics table cache '"
+                           << filename << "': " << e.what();
+        return;
+    }
+    CELER_LOG(info) << "Saved physics tables to '" << filename << "'";
+}
+
 //---------------------------------------------------------------------------//
 } // namespace celeritas
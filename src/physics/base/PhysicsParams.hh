@@ -7,7 +7,9 @@
 //---------------------------------------------------------------------------//
 #pragma once
 
+#include <cstdint>
 #include <memory>
+#include <string>
 #include <vector>
 #include "base/CollectionMirror.hh"
 #include "base/Types.hh"
@@ -19,6 +21,8 @@
 
 namespace celeritas
 {
+class CutoffParams;
+class ImportedProcesses;
 class MaterialParams;
 class ParticleParams;
 
@@ -51,6 +55,20 @@ class ParticleParams;
  *   longer valid. Use MC integration to sample the discrete interaction length
  *   with the correct probability.
  * - \c enable_fluctuation: enable simulation of energy loss fluctuations.
+ * - \c total_xs_table: precompute an upper bound of the summed macroscopic
+ *   cross sections of all tabulated processes for each particle and
+ *   material, so that the pre-step calculation is a single table lookup. The
+ *   individual cross sections are only calculated at the interaction point.
+ *
+ * If a cache file is given, the constructed tables are written to it, and
+ * later runs load the tables from it instead of building them. The cache is
+ * keyed on the options, the table precision, the process labels, the
+ * material properties, the particle/process/model mappings, the production
+ * cutoffs, and the imported physics tables. It is also checksummed; a stale
+ * or corrupt cache is ignored and overwritten. The cutoffs and imported
+ * tables are required when caching is enabled, and processes whose tables
+ * depend on other data should have their source data passed in through them
+ * so that changes to it invalidate the cache.
  */
 class PhysicsParams
 {
@@ -59,6 +77,8 @@ class PhysicsParams
     //! Type aliases
     using SPConstParticles   = std::shared_ptr<const ParticleParams>;
     using SPConstMaterials   = std::shared_ptr<const MaterialParams>;
+    using SPConstCutoffs     = std::shared_ptr<const CutoffParams>;
+    using SPConstImported    = std::shared_ptr<const ImportedProcesses>;
     using SPConstProcess     = std::shared_ptr<const Process>;
     using VecProcess         = std::vector<SPConstProcess>;
     using SpanConstProcessId = Span<const ProcessId>;
@@ -77,6 +97,7 @@ class PhysicsParams
         real_type linear_loss_limit   = 0.01;
         bool      use_integral_xs     = true;
         bool      enable_fluctuation  = true;
+        bool      total_xs_table      = false;
     };
 
     //! Physics parameter construction arguments
@@ -87,6 +108,15 @@ class PhysicsParams
         VecProcess       processes;
 
         Options options;
+
+        //! Path to a binary cache of the physics tables (disabled if empty)
+        std::string cache_file;
+        //! Production cuts used to generate the tables (cache key only,
+        //! required with a cache file)
+        SPConstCutoffs cutoffs;
+        //! Imported physics tables used by the processes (cache key only,
+        //! required with a cache file)
+        SPConstImported imported;
     };
 
   public:
@@ -129,6 +159,8 @@ class PhysicsParams
     using SPConstModel = std::shared_ptr<const Model>;
     using VecModel     = std::vector<std::pair<SPConstModel, ProcessId>>;
     using HostValue    = PhysicsParamsData<Ownership::value, MemSpace::host>;
+    using VecGridIds   = std::vector<ValueGridArray<ValueGridId>>;
+    using CacheKey     = std::uint64_t;
 
     // Host metadata/access
     VecProcess processes_;
@@ -138,16 +170,29 @@ class PhysicsParams
     CollectionMirror<PhysicsParamsData> data_;
 
   private:
-    VecModel build_models() const;
-    void     build_options(const Options& opts, HostValue* data) const;
-    void     build_ids(const ParticleParams& particles, HostValue* data) const;
-    void     build_xs(const Options&        opts,
-                      const MaterialParams& mats,
-                      HostValue*            data) const;
-    void     build_fluct(const Options&        opts,
-                         const MaterialParams& mats,
-                         const ParticleParams& particles,
+    VecModel   build_models() const;
+    void       build_options(const Options& opts, HostValue* data) const;
+    void       build_ids(const ParticleParams& particles,
                          HostValue*            data) const;
+    VecGridIds build_grids(const MaterialParams& mats, HostValue* data) const;
+    void       build_xs(const Options&        opts,
+                        const MaterialParams& mats,
+                        HostValue*            data) const;
+    void       build_total_xs(const MaterialParams& mats,
+                              HostValue*            data) const;
+    void       build_model_lookup(HostValue* data) const;
+    void       build_fluct(const Options&        opts,
+                           const MaterialParams& mats,
+                           const ParticleParams& particles,
+                           HostValue*            data) const;
+
+    CacheKey calc_cache_key(const Input& inp, const HostValue& data) const;
+    bool     load_cache(const std::string& filename,
+                        CacheKey           key,
+                        HostValue*         data) const;
+    void     save_cache(const std::string& filename,
+                        CacheKey           key,
+                        const HostValue&   data) const;
 };
 
 //---------------------------------------------------------------------------//
@@ -14,6 +14,7 @@
 #include "random/distributions/GenerateCanonical.hh"
 #include "random/Selector.hh"
 #include "physics/em/EnergyLossDistribution.hh"
+#include "physics/grid/EnergyLookupCache.hh"
 #include "physics/grid/EnergyLossCalculator.hh"
 #include "physics/grid/InverseRangeCalculator.hh"
 #include "physics/grid/RangeCalculator.hh"
@@ -26,6 +27,15 @@ namespace celeritas
 //---------------------------------------------------------------------------//
 /*!
  * Calculate physics step limits based on cross sections and range limiters.
+ *
+ * If the summed cross section tables are available for this particle and
+ * material, the total cross section of the tabulated processes is a single
+ * lookup; only hardwired processes are evaluated (and saved) individually,
+ * and the remaining per-process cross sections are deferred to
+ * \c select_process_and_model .
+ *
+ * The energy loss rate and range of the energy loss process at the pre-step
+ * energy are saved to the physics state for \c calc_energy_loss .
  */
 inline CELER_FUNCTION real_type
 calc_tabulated_physics_step(const MaterialTrackView& material,
@@ -37,14 +47,27 @@ calc_tabulated_physics_step(const MaterialTrackView& material,
     const real_type inf = numeric_limits<real_type>::infinity();
     using VGT           = ValueGridType;
 
+    // Calculate the log energy and grid locations once for all tables
+    EnergyLookupCache lookup(particle.energy());
+
+    // Upper bound on the cross sections of all the tabulated processes
+    real_type total_macro_xs = 0;
+    auto      total_grid_id  = physics.total_xs_grid();
+    if (total_grid_id)
+    {
+        auto calc_xs   = physics.make_calculator<XsCalculator>(total_grid_id);
+        total_macro_xs = calc_xs(lookup);
+    }
+
     // Loop over all processes that apply to this track (based on particle
     // type) and calculate cross section and particle range.
-    real_type total_macro_xs = 0;
-    real_type min_range      = inf;
+    const ParticleProcessId eloss_ppid  = physics.eloss_ppid();
+    real_type               min_range   = inf;
+    real_type               eloss_range = 0;
     for (auto ppid : range(ParticleProcessId{physics.num_particle_processes()}))
     {
         real_type process_xs = 0;
-        if (auto model_id = physics.hardwired_model(ppid, particle.energy()))
+        if (auto model_id = physics.hardwired_model(ppid, lookup))
         {
             // Calculate macroscopic cross section on the fly for special
             // hardwired processes.
@@ -53,12 +76,17 @@ calc_tabulated_physics_step(const MaterialTrackView& material,
                 model_id, material_view, particle.energy());
             total_macro_xs += process_xs;
         }
+        else if (total_grid_id)
+        {
+            // Cross section is included in the total and will be calculated
+            // if this track interacts
+        }
         else if (auto grid_id = physics.value_grid(VGT::macro_xs, ppid))
         {
             // Calculate macroscopic cross section for this process, then
             // accumulate it into the total cross section and save the cross
             // section for later.
-            process_xs = physics.calc_xs(ppid, grid_id, particle.energy());
+            process_xs = physics.calc_xs(ppid, grid_id, lookup);
             total_macro_xs += process_xs;
         }
         physics.per_process_xs(ppid) = process_xs;
@@ -66,11 +94,30 @@ calc_tabulated_physics_step(const MaterialTrackView& material,
         if (auto grid_id = physics.value_grid(VGT::range, ppid))
         {
             auto calc_range = physics.make_calculator<RangeCalculator>(grid_id);
-            real_type process_range = calc_range(particle.energy());
+            real_type process_range = calc_range(lookup);
             min_range               = min(min_range, process_range);
+            if (ppid == eloss_ppid)
+            {
+                eloss_range = process_range;
+            }
         }
     }
     physics.macro_xs(total_macro_xs);
+    physics.macro_xs_energy(particle.energy());
+
+    // Calculate the energy loss rate while the grid location is known
+    real_type eloss_rate = 0;
+    if (eloss_ppid)
+    {
+        if (auto grid_id = physics.value_grid(VGT::energy_loss, eloss_ppid))
+        {
+            auto calc_eloss_rate
+                = physics.make_calculator<EnergyLossCalculator>(grid_id);
+            eloss_rate = calc_eloss_rate(lookup);
+        }
+    }
+    physics.eloss_rate(eloss_rate);
+    physics.eloss_range(eloss_range);
 
     if (min_range != inf)
     {
@@ -122,9 +169,12 @@ calc_tabulated_physics_step(const MaterialTrackView& material,
  * including multiple scattering) is calculated first, then checked against
  * being greater than the linear loss limit.
  *
- * If energy loss is greater than the loss limit, we loop over all
- * processes with range tables and recalculate the pre-step range and solve for
- * the exact post-step energy loss.
+ * If energy loss is greater than the loss limit, we use the pre-step range
+ * of the energy loss process and solve for the exact post-step energy loss.
+ *
+ * The pre-step energy loss rate and range are those saved by
+ * \c calc_tabulated_physics_step , which must be called at the same particle
+ * energy (and in the same material) before this function.
  *
  * \note The inverse range correction assumes range is always the integral of
  * the stopping power/energy loss.
@@ -145,6 +195,7 @@ CELER_FUNCTION ParticleTrackView::Energy
                                 Engine&                  rng)
 {
     CELER_EXPECT(step >= 0);
+    CELER_EXPECT(physics.macro_xs_energy() == particle.energy());
     static_assert(ParticleTrackView::Energy::unit_type::value()
                       == EnergyLossCalculator::Energy::unit_type::value(),
                   "Incompatible energy types");
@@ -152,20 +203,8 @@ CELER_FUNCTION ParticleTrackView::Energy
     using VGT                  = ValueGridType;
     const auto pre_step_energy = particle.energy();
 
-    // Calculate the sum of energy loss rate over all processes.
-    real_type total_eloss_rate = 0;
-    if (auto ppid = physics.eloss_ppid())
-    {
-        if (auto grid_id = physics.value_grid(VGT::energy_loss, ppid))
-        {
-            auto calc_eloss_rate
-                = physics.make_calculator<EnergyLossCalculator>(grid_id);
-            total_eloss_rate = calc_eloss_rate(pre_step_energy);
-        }
-    }
-
-    // Scale loss rate by step length
-    real_type eloss = total_eloss_rate * step;
+    // Scale the pre-step loss rate (summed over all processes) by step length
+    real_type eloss = physics.eloss_rate() * step;
 
     if (eloss > pre_step_energy.value() * physics.linear_loss_limit())
     {
@@ -178,10 +217,7 @@ CELER_FUNCTION ParticleTrackView::Energy
         {
             if (auto grid_id = physics.value_grid(VGT::range, ppid))
             {
-                // Recalculate beginning-of-step range (instead of storing)
-                auto calc_range
-                    = physics.make_calculator<RangeCalculator>(grid_id);
-                real_type remaining_range = calc_range(pre_step_energy) - step;
+                real_type remaining_range = physics.eloss_range() - step;
                 CELER_ASSERT(remaining_range >= 0);
 
                 // Calculate energy along the range curve corresponding to the
@@ -222,6 +258,11 @@ CELER_FUNCTION ParticleTrackView::Energy
  *   interaction. Otherwise, the result is a false ModelId.
  * - Sample from the previously calculated per-process cross section/decay to
  *   determine the interacting process ID.
+ * - If the pre-step total was looked up from the summed cross section table,
+ *   the per-process cross sections are first calculated at the pre-step
+ *   energy. Since the table is an upper bound, the difference between it and
+ *   the true total is sampled as a "null" interaction that resets the
+ *   physics state without changing the track.
  * - From the process ID and (post-slowing-down) particle energy, we obtain the
  *   applicable model ID.
  * - For energy loss (continuous-discrete) processes, the post-step energy will
@@ -237,13 +278,52 @@ CELER_FUNCTION ProcessIdModelId select_process_and_model(
     // Nonzero MFP to interaction -- no interaction model
     CELER_EXPECT(physics.interaction_mfp() <= 0);
 
-    // Sample ParticleProcessId from physics.per_process_xs()
-    ParticleProcessId ppid = celeritas::make_selector(
-        [&physics](ParticleProcessId ppid) {
-            return physics.per_process_xs(ppid);
-        },
-        ParticleProcessId{physics.num_particle_processes()},
-        physics.macro_xs())(rng);
+    ParticleProcessId ppid;
+    if (physics.total_xs_grid())
+    {
+        // Calculate the deferred per-process cross sections at the pre-step
+        // energy while sampling; hardwired ones were saved in the pre-step
+        const auto        energy = physics.macro_xs_energy();
+        EnergyLookupCache lookup(energy);
+        const ParticleProcessId::size_type num_processes
+            = physics.num_particle_processes();
+
+        real_type remaining = physics.macro_xs() * generate_canonical(rng);
+        for (auto i : range(num_processes))
+        {
+            ParticleProcessId cur{i};
+            if (!physics.hardwired_model(cur, lookup))
+            {
+                auto grid_id = physics.value_grid(ValueGridType::macro_xs, cur);
+                physics.per_process_xs(cur)
+                    = grid_id ? physics.calc_xs(cur, grid_id, lookup) : 0;
+            }
+            remaining -= physics.per_process_xs(cur);
+            if (remaining < 0)
+            {
+                ppid = cur;
+                break;
+            }
+        }
+
+        if (!ppid)
+        {
+            // Null interaction from the tabulated upper bound: reset the
+            // physics state and continue tracking
+            physics = {};
+            return {};
+        }
+    }
+    else
+    {
+        // Sample ParticleProcessId from physics.per_process_xs()
+        ppid = celeritas::make_selector(
+            [&physics](ParticleProcessId ppid) {
+                return physics.per_process_xs(ppid);
+            },
+            ParticleProcessId{physics.num_particle_processes()},
+            physics.macro_xs())(rng);
+    }
 
     // Determine if the discrete interaction occurs for energy loss
     // processes
@@ -260,9 +340,10 @@ CELER_FUNCTION ProcessIdModelId select_process_and_model(
         real_type xs      = calc_xs(particle.energy());
 
         // The discrete interaction occurs with probability \f$ \sigma(E_1) /
-        // \sigma_{\max} \f$. Note that it's possible for \f$ \sigma(E_1) \f$
-        // to be larger than the estimate of the maximum cross section over the
-        // step \f$ \sigma_{\max} \f$.
+        // \sigma_{\max} \f$. The envelope \f$ \sigma_{\max} \f$ bounds the
+        // cross section over \f$ [\xi E_0, E_0] \f$, so \f$ \sigma(E_1) \f$
+        // can only exceed it if the particle lost more than a fraction \f$
+        // 1 - \xi \f$ of its energy over the step.
         if (generate_canonical(rng) > xs / physics.per_process_xs(ppid))
         {
             // No interaction occurs; reset the physics state and continue
@@ -11,9 +11,10 @@
 #include "base/Macros.hh"
 #include "base/Types.hh"
 #include "physics/base/Units.hh"
-#include "physics/grid/GridIdFinder.hh"
+#include "physics/grid/EnergyLookupCache.hh"
 #include "physics/material/MaterialView.hh"
 #include "physics/material/Types.hh"
+#include "ModelFinder.hh"
 #include "Types.hh"
 
 namespace celeritas
@@ -37,8 +38,7 @@ class PhysicsTrackView
         = PhysicsParamsData<Ownership::const_reference, MemSpace::native>;
     using PhysicsStateRef
         = PhysicsStateData<Ownership::reference, MemSpace::native>;
-    using MevEnergy   = units::MevEnergy;
-    using ModelFinder = GridIdFinder<MevEnergy, ModelId>;
+    using MevEnergy = units::MevEnergy;
     //!@}
 
   public:
@@ -61,6 +61,15 @@ class PhysicsTrackView
     // Set the total (process-integrated) macroscopic xs [cm^-1]
     inline CELER_FUNCTION void macro_xs(real_type);
 
+    // Set the energy at which the total macroscopic xs was calculated
+    inline CELER_FUNCTION void macro_xs_energy(MevEnergy);
+
+    // Set the pre-step energy loss rate [MeV/cm]
+    inline CELER_FUNCTION void eloss_rate(real_type);
+
+    // Set the pre-step range of the energy loss process [cm]
+    inline CELER_FUNCTION void eloss_range(real_type);
+
     // Select a model for the current interaction (or {} for no interaction)
     inline CELER_FUNCTION void model_id(ModelId);
 
@@ -78,6 +87,15 @@ class PhysicsTrackView
     // Total (process-integrated) macroscopic xs [cm^-1]
     CELER_FORCEINLINE_FUNCTION real_type macro_xs() const;
 
+    // Energy at which the total macroscopic xs was calculated [MeV]
+    CELER_FORCEINLINE_FUNCTION MevEnergy macro_xs_energy() const;
+
+    // Pre-step energy loss rate [MeV/cm]
+    CELER_FORCEINLINE_FUNCTION real_type eloss_rate() const;
+
+    // Pre-step range of the energy loss process [cm]
+    CELER_FORCEINLINE_FUNCTION real_type eloss_range() const;
+
     // Selected model if interacting
     CELER_FORCEINLINE_FUNCTION ModelId model_id() const;
 
@@ -94,21 +112,33 @@ class PhysicsTrackView
     inline CELER_FUNCTION ValueGridId value_grid(ValueGridType table,
                                                  ParticleProcessId) const;
 
+    // Get upper bound of the summed tabulated xs, null if not present
+    inline CELER_FUNCTION ValueGridId total_xs_grid() const;
+
     // Whether to use integral approach to sample the discrete interaction
     inline CELER_FUNCTION bool use_integral_xs(ParticleProcessId ppid) const;
 
-    // Energy corresponding to the maximum cross section for the material
-    inline CELER_FUNCTION real_type energy_max_xs(ParticleProcessId ppid) const;
+    // Get the max xs over the step for the integral approach, null if absent
+    inline CELER_FUNCTION ValueGridId max_xs_grid(ParticleProcessId ppid) const;
 
     // Calculate macroscopic cross section for the process
     inline CELER_FUNCTION real_type calc_xs(ParticleProcessId ppid,
                                             ValueGridId       grid_id,
                                             MevEnergy         energy) const;
 
+    // Calculate macroscopic cross section from a cached energy lookup
+    inline CELER_FUNCTION real_type calc_xs(ParticleProcessId  ppid,
+                                            ValueGridId        grid_id,
+                                            EnergyLookupCache& lookup) const;
+
     // Get hardwired model, null if not present
     inline CELER_FUNCTION ModelId hardwired_model(ParticleProcessId ppid,
                                                   MevEnergy energy) const;
 
+    // Get hardwired model from a cached energy lookup, null if not present
+    inline CELER_FUNCTION ModelId
+    hardwired_model(ParticleProcessId ppid, EnergyLookupCache& lookup) const;
+
     // Particle-process ID of the process with the de/dx and range tables
     inline CELER_FUNCTION ParticleProcessId eloss_ppid() const;
 
@@ -171,6 +201,8 @@ class PhysicsTrackView
     CELER_FORCEINLINE_FUNCTION PhysicsTrackState& state();
     CELER_FORCEINLINE_FUNCTION const PhysicsTrackState& state() const;
     CELER_FORCEINLINE_FUNCTION const ProcessGroup& process_group() const;
+    CELER_FORCEINLINE_FUNCTION bool
+    is_hardwired(ParticleProcessId ppid, MevEnergy energy) const;
 };
 
 //---------------------------------------------------------------------------//
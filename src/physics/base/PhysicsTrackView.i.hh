@@ -43,6 +43,9 @@ PhysicsTrackView::operator=(const Initializer_t&)
     this->state().interaction_mfp = -1;
     this->state().step_length     = -1;
     this->state().macro_xs        = -1;
+    this->state().macro_xs_energy = -1;
+    this->state().eloss_rate      = -1;
+    this->state().eloss_range     = -1;
     this->state().model_id        = ModelId{};
     return *this;
 }
@@ -79,6 +82,36 @@ CELER_FUNCTION void PhysicsTrackView::macro_xs(real_type inv_distance)
     this->state().macro_xs = inv_distance;
 }
 
+//---------------------------------------------------------------------------//
+/*!
+ * Set the pre-step energy at which the total cross section was calculated.
+ */
+CELER_FUNCTION void PhysicsTrackView::macro_xs_energy(MevEnergy energy)
+{
+    CELER_EXPECT(energy >= zero_quantity());
+    this->state().macro_xs_energy = energy.value();
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * Set the pre-step energy loss rate.
+ */
+CELER_FUNCTION void PhysicsTrackView::eloss_rate(real_type rate)
+{
+    CELER_EXPECT(rate >= 0);
+    this->state().eloss_rate = rate;
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * Set the pre-step range of the energy loss process.
+ */
+CELER_FUNCTION void PhysicsTrackView::eloss_range(real_type distance)
+{
+    CELER_EXPECT(distance >= 0);
+    this->state().eloss_range = distance;
+}
+
 //---------------------------------------------------------------------------//
 /*!
  * Select a model ID for the current track.
@@ -136,6 +169,48 @@ CELER_FUNCTION real_type PhysicsTrackView::macro_xs() const
     return xs;
 }
 
+//---------------------------------------------------------------------------//
+/*!
+ * Energy at which the process-integrated macroscopic XS was calculated.
+ *
+ * This is needed to recalculate the per-process cross sections at the
+ * interaction point when they were not stored by the pre-step kernel.
+ */
+CELER_FUNCTION auto PhysicsTrackView::macro_xs_energy() const -> MevEnergy
+{
+    real_type energy = this->state().macro_xs_energy;
+    CELER_ENSURE(energy >= 0);
+    return MevEnergy{energy};
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * Energy loss rate at the pre-step energy.
+ *
+ * This is calculated with the step limits so that the energy loss
+ * calculation doesn't have to look it up again.
+ */
+CELER_FUNCTION real_type PhysicsTrackView::eloss_rate() const
+{
+    real_type rate = this->state().eloss_rate;
+    CELER_ENSURE(rate >= 0);
+    return rate;
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * Range of the energy loss process at the pre-step energy.
+ *
+ * This is needed to calculate the energy loss along the range curve when the
+ * step is long enough that the loss rate can't be treated as constant.
+ */
+CELER_FUNCTION real_type PhysicsTrackView::eloss_range() const
+{
+    real_type distance = this->state().eloss_range;
+    CELER_ENSURE(distance >= 0);
+    return distance;
+}
+
 //---------------------------------------------------------------------------//
 /*!
  * Access the model ID that has been selected for the current track.
@@ -201,6 +276,31 @@ CELER_FUNCTION auto PhysicsTrackView::value_grid(ValueGridType     table_type,
     return params_.value_grid_ids[grid_id_ref];
 }
 
+//---------------------------------------------------------------------------//
+/*!
+ * Return the summed cross section grid for this particle and material.
+ *
+ * This is an upper bound on the sum of the macroscopic cross sections (or
+ * integral approach estimates) of all the processes that are tabulated for
+ * this particle. Hardwired processes must still be calculated on the fly. The
+ * result is null if the summed tables are disabled or if no process has a
+ * cross section table for this material.
+ */
+CELER_FUNCTION auto PhysicsTrackView::total_xs_grid() const -> ValueGridId
+{
+    ValueTableId table_id = this->process_group().total_xs;
+    if (!table_id)
+        return {}; // Summed tables are disabled
+
+    const ValueTable& table = params_.value_tables[table_id];
+    CELER_ASSERT(material_ < table.material.size());
+    auto grid_id_ref = table.material[material_.get()];
+    if (!grid_id_ref)
+        return {}; // No tabulated cross sections for this material
+
+    return params_.value_grid_ids[grid_id_ref];
+}
+
 //---------------------------------------------------------------------------//
 /*!
  * Whether to use integral approach to sample the discrete interaction.
@@ -231,67 +331,80 @@ CELER_FUNCTION bool
 PhysicsTrackView::use_integral_xs(ParticleProcessId ppid) const
 {
     CELER_EXPECT(ppid < this->num_particle_processes());
-    return this->energy_max_xs(ppid) > 0;
+    return static_cast<bool>(this->max_xs_grid(ppid));
 }
 
 //---------------------------------------------------------------------------//
 /*!
- * Energy corresponding to the maximum cross section for the material.
+ * Return the envelope of the maximum cross section over a step.
  *
- * If the \c IntegralXsProcess is "true", the integral approach is used and
- * that process has both energy loss and macro xs tables. If \c
- * energy_max_xs[material] is nonzero, both of those tables are present for
- * this material.
- */
-CELER_FUNCTION real_type
-PhysicsTrackView::energy_max_xs(ParticleProcessId ppid) const
+ * The value at energy \f$ E \f$ is an upper bound on the largest cross
+ * section of the process in \f$ [\xi E, E] \f$, tabulated on the cross section
+ * grid of the process. If the process and material have both energy loss and
+ * macro xs tables, the integral approach is used and this grid is present.
+ * The result is null if the integral approach is not used for this
+ * particle-process and material.
+ */
+CELER_FUNCTION auto PhysicsTrackView::max_xs_grid(ParticleProcessId ppid) const
+    -> ValueGridId
 {
     CELER_EXPECT(ppid < this->num_particle_processes());
 
-    real_type                result = 0;
     const IntegralXsProcess& process
         = params_.integral_xs[this->process_group().integral_xs[ppid.get()]];
-    if (process)
-    {
-        CELER_ASSERT(material_ < process.energy_max_xs.size());
-        result = params_.reals[process.energy_max_xs[material_.get()]];
-    }
-    return result;
+    if (!process.max_xs)
+        return {};
+
+    const ValueTable& table = params_.value_tables[process.max_xs];
+    CELER_ASSERT(material_ < table.material.size());
+    auto grid_id_ref = table.material[material_.get()];
+    if (!grid_id_ref)
+        return {};
+
+    return params_.value_grid_ids[grid_id_ref];
 }
 
 //---------------------------------------------------------------------------//
 /*!
  * Calculate macroscopic cross section for the process.
  *
- * If this is an energy loss process, this returns the estimate of the maximum
- * cross section over the step. If the energy of the global maximum of the
- * cross section (calculated at initialization) is in the interval \f$ [\xi
- * E_0, E_0) \f$, where \f$ E_0 \f$ is the pre-step energy and \f$ \xi \f$ is
- * \c energy_fraction, \f$ \sigma_{\max} \f$ is set to the global maximum.
- * Otherwise, \f$ \sigma_{\max} = \max( \sigma(E_0), \sigma(\xi E_0) ) \f$. If
- * the cross section is not monotonic in the interval \f$ [\xi E_0, E_0) \f$
- * and the interval does not contain the global maximum, the post-step cross
- * section \f$ \sigma(E_1) \f$ may be larger than \f$ \sigma_{\max} \f$.
+ * If this is an energy loss process, this returns an upper bound on the
+ * maximum cross section over the step, \f$ \sigma_{\max} \ge \max_{E \in [\xi
+ * E_0, E_0]} \sigma(E) \f$, where \f$ E_0 \f$ is the pre-step energy and \f$
+ * \xi \f$ is \c energy_fraction. At initialization, each grid point of the
+ * cross section stores the largest cross section over any step starting in
+ * either adjacent cell, so the linearly interpolated envelope bounds the
+ * maximum everywhere and is tight where the cross section is flat.
  */
 CELER_FUNCTION real_type PhysicsTrackView::calc_xs(ParticleProcessId ppid,
                                                    ValueGridId       grid_id,
                                                    MevEnergy energy) const
 {
-    auto calc_xs = this->make_calculator<XsCalculator>(grid_id);
+    EnergyLookupCache lookup(energy);
+    return this->calc_xs(ppid, grid_id, lookup);
+}
 
-    // Check if the integral approach is used (true if \c energy_max_xs > 0).
-    // If so, an estimate of the maximum cross section over the step is used as
-    // the macro xs for this process
-    real_type energy_max_xs = this->energy_max_xs(ppid);
-    if (energy_max_xs > 0)
+//---------------------------------------------------------------------------//
+/*!
+ * Calculate macroscopic cross section from a cached energy lookup.
+ *
+ * If the integral approach is used, only the envelope is looked up: its grid
+ * is cached alongside the cross section grids of the other processes.
+ */
+CELER_FUNCTION real_type
+PhysicsTrackView::calc_xs(ParticleProcessId  ppid,
+                          ValueGridId        grid_id,
+                          EnergyLookupCache& lookup) const
+{
+    // If the integral approach is used, the maximum cross section over the
+    // step is used as the macro xs for this process
+    if (ValueGridId max_xs_grid = this->max_xs_grid(ppid))
     {
-        real_type energy_xi = energy.value() * this->energy_fraction();
-        if (energy_max_xs >= energy_xi && energy_max_xs < energy.value())
-            return calc_xs(MevEnergy{energy_max_xs});
-        return max(calc_xs(energy), calc_xs(MevEnergy{energy_xi}));
+        grid_id = max_xs_grid;
     }
 
-    return calc_xs(energy);
+    auto calc_xs = this->make_calculator<XsCalculator>(grid_id);
+    return calc_xs(lookup);
 }
 
 //---------------------------------------------------------------------------//
@@ -303,10 +416,7 @@ CELER_FUNCTION real_type PhysicsTrackView::calc_xs(ParticleProcessId ppid,
 CELER_FUNCTION ModelId PhysicsTrackView::hardwired_model(ParticleProcessId ppid,
                                                          MevEnergy energy) const
 {
-    ProcessId process = this->process(ppid);
-    if ((process == this->photoelectric_process_id()
-         && energy < params_.hardwired.photoelectric_table_thresh)
-        || (process == this->eplusgg_process_id()))
+    if (this->is_hardwired(ppid, energy))
     {
         auto find_model = this->make_model_finder(ppid);
         return find_model(energy);
@@ -315,6 +425,25 @@ CELER_FUNCTION ModelId PhysicsTrackView::hardwired_model(ParticleProcessId ppid,
     return {};
 }
 
+//---------------------------------------------------------------------------//
+/*!
+ * Return the hardwired model ID using a cached energy lookup.
+ *
+ * The model lookup reuses the energy location on the process's cross section
+ * grid when it has already been calculated.
+ */
+CELER_FUNCTION ModelId PhysicsTrackView::hardwired_model(
+    ParticleProcessId ppid, EnergyLookupCache& lookup) const
+{
+    if (this->is_hardwired(ppid, lookup.energy()))
+    {
+        auto find_model = this->make_model_finder(ppid);
+        return find_model(lookup);
+    }
+    // Not a hardwired process
+    return {};
+}
+
 //---------------------------------------------------------------------------//
 /*!
  * Particle-process ID of the process with the de/dx and range tables.
@@ -335,7 +464,10 @@ PhysicsTrackView::make_model_finder(ParticleProcessId ppid) const
     CELER_EXPECT(ppid < this->num_particle_processes());
     const ModelGroup& md
         = params_.model_groups[this->process_group().models[ppid.get()]];
-    return ModelFinder(params_.reals[md.energy], params_.model_ids[md.model]);
+    return ModelFinder(params_.reals[md.energy],
+                       params_.model_ids[md.model],
+                       md.lookup_grid,
+                       params_.model_indices[md.lookup_model]);
 }
 
 //---------------------------------------------------------------------------//
@@ -449,7 +581,7 @@ template<class T>
 CELER_FUNCTION T PhysicsTrackView::make_calculator(ValueGridId id) const
 {
     CELER_EXPECT(id < params_.value_grids.size());
-    return T{params_.value_grids[id], params_.reals};
+    return T{params_.value_grids[id], params_.grid_values};
 }
 
 //---------------------------------------------------------------------------//
@@ -518,5 +650,15 @@ CELER_FUNCTION const ProcessGroup& PhysicsTrackView::process_group() const
     return params_.process_groups[particle_];
 }
 
+//! Whether the process calculates cross sections on the fly at this energy
+CELER_FUNCTION bool
+PhysicsTrackView::is_hardwired(ParticleProcessId ppid, MevEnergy energy) const
+{
+    ProcessId process = this->process(ppid);
+    return (process == this->photoelectric_process_id()
+            && energy < params_.hardwired.photoelectric_table_thresh)
+           || (process == this->eplusgg_process_id());
+}
+
 //---------------------------------------------------------------------------//
 } // namespace celeritas
@@ -7,33 +7,107 @@
 //---------------------------------------------------------------------------//
 #include "BetheHeitlerModel.hh"
 
+#include <cmath>
+#include "base/Algorithms.hh"
 #include "base/Assert.hh"
 #include "physics/base/PDGNumber.hh"
+#include "physics/material/ElementCdfBuilder.hh"
 #include "physics/em/generated/BetheHeitlerInteract.hh"
 
 namespace celeritas
 {
+namespace
+{
+//---------------------------------------------------------------------------//
+/*!
+ * Calculate the per-atom pair production cross section.
+ *
+ * This is the parameterization used by \c G4BetheHeitlerModel (in microbarn)
+ * for \f$ E \ge 1.5 \f$ MeV, which is extrapolated below that energy as the
+ * square of the kinetic energy available to the pair.
+ */
+real_type calc_pair_xs(int z, real_type energy, real_type electron_mass)
+{
+    constexpr real_type a[] = {
+        8.7842e2, -1.9625e3, 1.2949e3, -2.0028e2, 1.2575e1, -2.8333e-1};
+    constexpr real_type b[] = {
+        -1.0342e1, 1.7692e1, -8.2381, 1.3063, -9.0815e-2, 2.3586e-3};
+    constexpr real_type c[] = {
+        -4.5263e2, 1.1161e3, -8.6749e2, 2.1773e2, -2.0467e1, 6.5372e-1};
+    constexpr real_type low_energy_limit = 1.5;
+
+    if (energy <= 2 * electron_mass)
+    {
+        return 0;
+    }
+
+    // Evaluate the polynomials in log energy
+    const real_type x = std::log(celeritas::max(energy, low_energy_limit)
+                                 / electron_mass);
+    real_type       f1 = 0;
+    real_type       f2 = 0;
+    real_type       f3 = 0;
+    for (int i = 5; i >= 0; --i)
+    {
+        f1 = f1 * x + a[i];
+        f2 = f2 * x + b[i];
+        f3 = f3 * x + c[i];
+    }
+    real_type result = (z + 1) * z * (f1 + f2 * z + f3 / z);
+
+    if (energy < low_energy_limit)
+    {
+        result *= ipow<2>((energy - 2 * electron_mass)
+                          / (low_energy_limit - 2 * electron_mass));
+    }
+    return celeritas::max<real_type>(result, 0);
+}
+
+//---------------------------------------------------------------------------//
+} // namespace
+
 //---------------------------------------------------------------------------//
 /*!
  * Construct from model ID and other necessary data.
  */
 BetheHeitlerModel::BetheHeitlerModel(ModelId               id,
-                                     const ParticleParams& particles)
+                                     const ParticleParams& particles,
+                                     const MaterialParams& materials,
+                                     bool                  enable_element_cdf)
 {
     CELER_EXPECT(id);
-    interface_.model_id    = id;
-    interface_.electron_id = particles.find(pdg::electron());
-    interface_.positron_id = particles.find(pdg::positron());
-    interface_.gamma_id    = particles.find(pdg::gamma());
 
-    CELER_VALIDATE(interface_.electron_id && interface_.positron_id
-                       && interface_.gamma_id,
+    detail::BetheHeitlerData<Ownership::value, MemSpace::host> host_data;
+    host_data.model_id    = id;
+    host_data.electron_id = particles.find(pdg::electron());
+    host_data.positron_id = particles.find(pdg::positron());
+    host_data.gamma_id    = particles.find(pdg::gamma());
+
+    CELER_VALIDATE(host_data.electron_id && host_data.positron_id
+                       && host_data.gamma_id,
                    << "missing electron, positron and/or gamma particles "
                       "(required for "
                    << this->label() << ")");
-    interface_.electron_mass
-        = particles.get(interface_.electron_id).mass().value();
-    CELER_ENSURE(interface_);
+    host_data.electron_mass
+        = particles.get(host_data.electron_id).mass().value();
+
+    if (enable_element_cdf)
+    {
+        const real_type   electron_mass = host_data.electron_mass;
+        ElementCdfBuilder build_cdf(materials,
+                                    units::MevEnergy{2 * electron_mass},
+                                    units::MevEnergy{1e5});
+        host_data.element_cdf
+            = build_cdf([&](ElementId el_id, units::MevEnergy energy) {
+                  return calc_pair_xs(materials.get(el_id).atomic_number(),
+                                      energy.value(),
+                                      electron_mass);
+              });
+    }
+
+    // Move to mirrored data, copying to device
+    data_ = CollectionMirror<detail::BetheHeitlerData>{std::move(host_data)};
+    CELER_ENSURE(this->data_);
 }
 
 //---------------------------------------------------------------------------//
@@ -43,7 +117,7 @@ BetheHeitlerModel::BetheHeitlerModel(ModelId               id,
 auto BetheHeitlerModel::applicability() const -> SetApplicability
 {
     Applicability photon_applic;
-    photon_applic.particle = interface_.gamma_id;
+    photon_applic.particle = this->host_ref().gamma_id;
     photon_applic.lower    = zero_quantity();
     photon_applic.upper    = units::MevEnergy{1e5};
 
@@ -57,12 +131,12 @@ auto BetheHeitlerModel::applicability() const -> SetApplicability
  */
 void BetheHeitlerModel::interact(const DeviceInteractRef& data) const
 {
-    generated::bethe_heitler_interact(interface_, data);
+    generated::bethe_heitler_interact(this->device_ref(), data);
 }
 
 void BetheHeitlerModel::interact(const HostInteractRef& data) const
 {
-    generated::bethe_heitler_interact(interface_, data);
+    generated::bethe_heitler_interact(this->host_ref(), data);
 }
 //!@}
 //---------------------------------------------------------------------------//
@@ -71,7 +145,7 @@ void BetheHeitlerModel::interact(const HostInteractRef& data) const
  */
 ModelId BetheHeitlerModel::model_id() const
 {
-    return interface_.model_id;
+    return this->host_ref().model_id;
 }
 
 //---------------------------------------------------------------------------//
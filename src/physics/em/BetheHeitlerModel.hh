@@ -8,7 +8,10 @@
 #pragma once
 
 #include "physics/base/Model.hh"
+
+#include "base/CollectionMirror.hh"
 #include "physics/base/ParticleParams.hh"
+#include "physics/material/MaterialParams.hh"
 #include "detail/BetheHeitlerData.hh"
 
 namespace celeritas
@@ -16,12 +19,26 @@ namespace celeritas
 //---------------------------------------------------------------------------//
 /*!
  * Set up and launch the Bethe-Heitler model interaction.
+ *
+ * If \c enable_element_cdf is set, the target element in a material with
+ * more than one element is sampled from tabulated probabilities weighted by
+ * the parameterized per-atom pair production cross section of Geant4's
+ * \c G4BetheHeitlerModel .
  */
 class BetheHeitlerModel final : public Model
 {
+  public:
+    //!@{
+    using HostRef   = detail::BetheHeitlerHostRef;
+    using DeviceRef = detail::BetheHeitlerDeviceRef;
+    //!@}
+
   public:
     // Construct from model ID and other necessary data
-    BetheHeitlerModel(ModelId id, const ParticleParams& particles);
+    BetheHeitlerModel(ModelId               id,
+                      const ParticleParams& particles,
+                      const MaterialParams& materials,
+                      bool                  enable_element_cdf = false);
 
     // Particle types and energy ranges that this model applies to
     SetApplicability applicability() const final;
@@ -38,8 +55,15 @@ class BetheHeitlerModel final : public Model
     //! Name of the model, for user interaction
     std::string label() const final { return "Bethe-Heitler"; }
 
+    //! Access data on the host
+    const HostRef& host_ref() const { return data_.host(); }
+
+    //! Access data on the device
+    const DeviceRef& device_ref() const { return data_.device(); }
+
   private:
-    detail::BetheHeitlerData interface_;
+    // Host/device storage and reference
+    CollectionMirror<detail::BetheHeitlerData> data_;
 };
 
 //---------------------------------------------------------------------------//
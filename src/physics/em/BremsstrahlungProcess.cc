@@ -46,14 +46,28 @@ auto BremsstrahlungProcess::build_models(ModelIdGenerator next_id) const
     if (options_.combined_model)
     {
         return {std::make_shared<CombinedBremModel>(
-            next_id(), *particles_, *materials_, load_data, options_.enable_lpm)};
+            next_id(),
+            *particles_,
+            *materials_,
+            load_data,
+            options_.enable_lpm,
+            options_.sb_tables,
+            options_.element_cdf)};
     }
     else
     {
         return {std::make_shared<SeltzerBergerModel>(
-                    next_id(), *particles_, *materials_, load_data),
-                std::make_shared<RelativisticBremModel>(
-                    next_id(), *particles_, *materials_, options_.enable_lpm)};
+                    next_id(),
+                    *particles_,
+                    *materials_,
+                    load_data,
+                    options_.sb_tables,
+                    options_.element_cdf),
+                std::make_shared<RelativisticBremModel>(next_id(),
+                                                        *particles_,
+                                                        *materials_,
+                                                        options_.enable_lpm,
+                                                        options_.element_cdf)};
     }
 }
 
@@ -36,6 +36,9 @@ class BremsstrahlungProcess : public Process
                                    //!interactor
         bool enable_lpm{true};     //!> Account for LPM effect at very high
                                    //!energies
+        bool sb_tables{false};     //!> Sample SB photon energy from tables
+        bool element_cdf{false};   //!> Sample elements from tabulated
+                                   //!probabilities
     };
 
   public:
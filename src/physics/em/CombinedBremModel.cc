@@ -7,7 +7,10 @@
 //---------------------------------------------------------------------------//
 #include "CombinedBremModel.hh"
 
+#include "base/Algorithms.hh"
+#include "physics/material/ElementCdfBuilder.hh"
 #include "physics/em/detail/PhysicsConstants.hh"
+#include "physics/em/detail/Utils.hh"
 #include "physics/em/generated/CombinedBremInteract.hh"
 
 namespace celeritas
@@ -20,7 +23,9 @@ CombinedBremModel::CombinedBremModel(ModelId               id,
                                      const ParticleParams& particles,
                                      const MaterialParams& materials,
                                      ReadData              sb_table,
-                                     bool                  enable_lpm)
+                                     bool                  enable_lpm,
+                                     bool enable_sampling_tables,
+                                     bool enable_element_cdf)
 {
     CELER_EXPECT(id);
     CELER_EXPECT(sb_table);
@@ -28,7 +33,7 @@ CombinedBremModel::CombinedBremModel(ModelId               id,
     // Construct SeltzerBergerModel and RelativisticBremModel and save the
     // host data reference
     sb_model_ = std::make_shared<SeltzerBergerModel>(
-        id, particles, materials, sb_table);
+        id, particles, materials, sb_table, enable_sampling_tables);
 
     rb_model_ = std::make_shared<RelativisticBremModel>(
         id, particles, materials, enable_lpm);
@@ -37,6 +42,26 @@ CombinedBremModel::CombinedBremModel(ModelId               id,
     host_ref.sb_differential_xs = sb_model_->host_ref().differential_xs;
     host_ref.rb_data            = rb_model_->host_ref();
 
+    if (enable_element_cdf)
+    {
+        // Weight elements by the soft-photon limit of the SB cross section
+        // below the SB limit and the relativistic one above it
+        const auto& sb_xs       = sb_model_->host_ref().differential_xs;
+        const auto& rb_elements = rb_model_->host_ref().elem_data;
+        ElementCdfBuilder build_cdf(
+            materials, units::MevEnergy{1e-3}, detail::high_energy_limit());
+        host_ref.element_cdf
+            = build_cdf([&](ElementId el_id, units::MevEnergy energy) {
+                  if (energy < detail::seltzer_berger_limit())
+                  {
+                      return ipow<2>(materials.get(el_id).atomic_number())
+                             * detail::calc_sb_soft_photon_xs(
+                                 sb_xs, el_id, energy);
+                  }
+                  return detail::calc_rb_soft_photon_xs(rb_elements[el_id]);
+              });
+    }
+
     // Move to mirrored data, copying to device
     data_ = CollectionMirror<detail::CombinedBremData>{std::move(host_ref)};
     CELER_ENSURE(this->data_);
@@ -43,7 +43,9 @@ class CombinedBremModel final : public Model
                       const ParticleParams& particles,
                       const MaterialParams& materials,
                       ReadData              load_sb_table,
-                      bool                  enable_lpm = true);
+                      bool                  enable_lpm             = true,
+                      bool                  enable_sampling_tables = false,
+                      bool                  enable_element_cdf     = false);
 
     // Particle types and energy ranges that this model applies to
     SetApplicability applicability() const final;
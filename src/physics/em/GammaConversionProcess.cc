@@ -14,17 +14,25 @@ namespace celeritas
 {
 //---------------------------------------------------------------------------//
 /*!
- * Construct from particles and imported Geant data.
+ * Construct from particles, materials, and imported Geant data.
+ *
+ * The materials are used to tabulate element selection probabilities if \c
+ * enable_element_cdf is set.
  */
 GammaConversionProcess::GammaConversionProcess(SPConstParticles particles,
-                                               SPConstImported  process_data)
+                                               SPConstMaterials materials,
+                                               SPConstImported  process_data,
+                                               bool enable_element_cdf)
     : particles_(std::move(particles))
+    , materials_(std::move(materials))
     , imported_(process_data,
                 particles_,
                 ImportProcessClass::conversion,
                 {pdg::gamma()})
+    , enable_element_cdf_(enable_element_cdf)
 {
     CELER_EXPECT(particles_);
+    CELER_EXPECT(materials_);
 }
 
 //---------------------------------------------------------------------------//
@@ -34,7 +42,8 @@ GammaConversionProcess::GammaConversionProcess(SPConstParticles particles,
 auto GammaConversionProcess::build_models(ModelIdGenerator next_id) const
     -> VecModel
 {
-    return {std::make_shared<BetheHeitlerModel>(next_id(), *particles_)};
+    return {std::make_shared<BetheHeitlerModel>(
+        next_id(), *particles_, *materials_, enable_element_cdf_)};
 }
 
 //---------------------------------------------------------------------------//
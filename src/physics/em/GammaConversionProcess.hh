@@ -11,6 +11,7 @@
 
 #include "physics/base/ImportedProcessAdapter.hh"
 #include "physics/base/ParticleParams.hh"
+#include "physics/material/MaterialParams.hh"
 
 namespace celeritas
 {
@@ -24,13 +25,16 @@ class GammaConversionProcess : public Process
     //!@{
     //! Type aliases
     using SPConstParticles = std::shared_ptr<const ParticleParams>;
+    using SPConstMaterials = std::shared_ptr<const MaterialParams>;
     using SPConstImported  = std::shared_ptr<const ImportedProcesses>;
     //!@}
 
   public:
-    // Construct from particle data
+    // Construct from particle and material data
     GammaConversionProcess(SPConstParticles particles,
-                           SPConstImported  process_data);
+                           SPConstMaterials materials,
+                           SPConstImported  process_data,
+                           bool             enable_element_cdf = false);
 
     // Construct the models associated with this process
     VecModel build_models(ModelIdGenerator next_id) const final;
@@ -45,8 +49,10 @@ class GammaConversionProcess : public Process
     std::string label() const final;
 
   private:
-    SPConstParticles particles_;
+    SPConstParticles       particles_;
+    SPConstMaterials       materials_;
     ImportedProcessAdapter imported_;
+    bool                   enable_element_cdf_;
 };
 
 //---------------------------------------------------------------------------//
@@ -18,16 +18,21 @@ namespace celeritas
 //---------------------------------------------------------------------------//
 /*!
  * Calculates the macroscopic cross section.
+ *
+ * If the model data has tabulated macroscopic cross sections, the cross
+ * section is interpolated from the material's table unless the energy is
+ * outside the table or in a grid bin containing an absorption edge. Otherwise
+ * the elemental cross sections are summed.
  */
 class LivermorePEMacroXsCalculator
 {
   public:
     //!@{
     //! Type aliases
-    using Energy              = detail::LivermorePEMicroXsCalculator::Energy;
-    using MicroXsUnits        = detail::LivermorePEMicroXsCalculator::XsUnits;
-    using XsUnits             = units::NativeUnit;
-    using LivermorePERef      = detail::LivermorePERef;
+    using Energy         = detail::LivermorePEMicroXsCalculator::Energy;
+    using MicroXsUnits   = detail::LivermorePEMicroXsCalculator::XsUnits;
+    using XsUnits        = units::NativeUnit;
+    using LivermorePERef = detail::LivermorePERef;
     //!@}
 
   public:
@@ -36,13 +41,17 @@ class LivermorePEMacroXsCalculator
     LivermorePEMacroXsCalculator(const LivermorePERef& shared,
                                  const MaterialView&   material);
 
-    // Compute cross section on the fly at the given energy
+    // Compute cross section at the given energy
     inline CELER_FUNCTION real_type operator()(Energy energy) const;
 
   private:
     const LivermorePERef&           shared_;
+    MaterialId                      material_;
     Span<const MatElementComponent> elements_;
     real_type                       number_density_;
+
+    // Compute cross section on the fly by summing the elements
+    inline CELER_FUNCTION real_type calc_elements(Energy energy) const;
 };
 
 //---------------------------------------------------------------------------//
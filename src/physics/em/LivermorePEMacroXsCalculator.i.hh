@@ -6,7 +6,10 @@
 //! \file LivermorePEMacroXsCalculator.i.hh
 //---------------------------------------------------------------------------//
 
+#include "base/Algorithms.hh"
 #include "base/Assert.hh"
+#include "physics/grid/EnergyLookupCache.hh"
+#include "physics/grid/XsCalculator.hh"
 
 namespace celeritas
 {
@@ -17,6 +20,7 @@ namespace celeritas
 CELER_FUNCTION LivermorePEMacroXsCalculator::LivermorePEMacroXsCalculator(
     const LivermorePERef& shared, const MaterialView& material)
     : shared_(shared)
+    , material_(material.material_id())
     , elements_(material.elements())
     , number_density_(material.number_density())
 {
@@ -25,11 +29,43 @@ CELER_FUNCTION LivermorePEMacroXsCalculator::LivermorePEMacroXsCalculator(
 
 //---------------------------------------------------------------------------//
 /*!
- * Compute macroscopic cross section for the photoelectric effect on the fly at
- * the given energy.
+ * Compute macroscopic cross section for the photoelectric effect at the given
+ * energy.
  */
 CELER_FUNCTION real_type
 LivermorePEMacroXsCalculator::operator()(Energy energy) const
+{
+    if (shared_.macro_xs)
+    {
+        const auto& macro_xs = shared_.macro_xs;
+        const detail::LivermorePEMacroXsTable& table
+            = macro_xs.materials[material_];
+        XsCalculator calc_xs(table.xs, macro_xs.values);
+
+        EnergyLookupCache lookup(energy);
+        if (lookup.log_energy() >= table.xs.log_energy.front
+            && lookup.log_energy() < table.xs.log_energy.back)
+        {
+            // Interpolate unless the bin contains an absorption edge
+            const size_type bin   = lookup.find(table.xs.log_energy).index;
+            const auto      edges = macro_xs.edge_bins[table.edge_bins];
+            const auto      iter
+                = celeritas::lower_bound(edges.begin(), edges.end(), bin);
+            if (iter == edges.end() || *iter != bin)
+            {
+                return calc_xs(lookup);
+            }
+        }
+    }
+    return this->calc_elements(energy);
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * Compute the macroscopic cross section by summing the elements.
+ */
+CELER_FUNCTION real_type
+LivermorePEMacroXsCalculator::calc_elements(Energy energy) const
 {
     real_type                            result = 0.;
     detail::LivermorePEMicroXsCalculator calc_micro_xs(shared_, energy);
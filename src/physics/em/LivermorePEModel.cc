@@ -7,14 +7,107 @@
 //---------------------------------------------------------------------------//
 #include "LivermorePEModel.hh"
 
+#include <algorithm>
+#include <cmath>
+#include <limits>
 #include "base/Assert.hh"
 #include "base/CollectionBuilder.hh"
 #include "comm/Device.hh"
 #include "physics/base/PDGNumber.hh"
+#include "physics/grid/UniformGrid.hh"
+#include "physics/material/ElementCdfBuilder.hh"
+#include "physics/em/detail/LivermorePEMicroXsCalculator.hh"
+#include "LivermorePEMacroXsCalculator.hh"
 #include "physics/em/generated/LivermorePEInteract.hh"
 
 namespace celeritas
 {
+namespace
+{
+//---------------------------------------------------------------------------//
+/*!
+ * Tabulate the macroscopic cross section of every material.
+ *
+ * The grid bins containing a binding energy or a threshold between the
+ * elemental cross section representations of any element in the material
+ * are marked so that the cross section is calculated exactly there.
+ */
+detail::LivermorePEMacroXsData<Ownership::value, MemSpace::host>
+build_macro_xs(const MaterialParams&              materials,
+               const detail::LivermorePEHostRef& shared,
+               const UniformGridData&            log_energy)
+{
+    using Energy = units::MevEnergy;
+
+    detail::LivermorePEMacroXsData<Ownership::value, MemSpace::host> result;
+    auto values    = make_builder(&result.values);
+    auto edge_bins = make_builder(&result.edge_bins);
+    auto tables    = make_builder(&result.materials);
+    tables.reserve(materials.num_materials());
+
+    const UniformGrid      loge_grid(log_energy);
+    std::vector<real_type> grid_energy(loge_grid.size());
+    for (auto i : range(loge_grid.size()))
+    {
+        grid_energy[i] = std::exp(loge_grid[i]);
+    }
+
+    // Find the bin (lower, upper] containing the energy, if any
+    auto find_edge_bin = [&grid_energy](real_type energy) -> size_type {
+        auto iter = std::lower_bound(
+            grid_energy.begin(), grid_energy.end(), energy);
+        if (iter == grid_energy.begin() || iter == grid_energy.end())
+        {
+            return grid_energy.size();
+        }
+        return iter - grid_energy.begin() - 1;
+    };
+
+    std::vector<table_real_type> xs(loge_grid.size());
+    std::vector<size_type>       bins;
+    for (auto mat_id : range(MaterialId{materials.num_materials()}))
+    {
+        const MaterialView           material(materials.host_ref(), mat_id);
+        LivermorePEMacroXsCalculator calc_macro_xs(shared, material);
+        for (auto i : range(loge_grid.size()))
+        {
+            xs[i] = calc_macro_xs(Energy{grid_energy[i]});
+        }
+
+        bins.clear();
+        for (const MatElementComponent& comp : material.elements())
+        {
+            const detail::LivermoreElement& el
+                = shared.xs.elements[comp.element];
+            for (const auto& shell : shared.xs.shells[el.shells])
+            {
+                bins.push_back(find_edge_bin(shell.binding_energy.value()));
+            }
+            bins.push_back(find_edge_bin(el.thresh_lo.value()));
+            bins.push_back(find_edge_bin(el.thresh_hi.value()));
+        }
+        std::sort(bins.begin(), bins.end());
+        bins.erase(std::unique(bins.begin(), bins.end()), bins.end());
+        while (!bins.empty() && bins.back() >= grid_energy.size())
+        {
+            bins.pop_back();
+        }
+
+        detail::LivermorePEMacroXsTable table;
+        table.xs.log_energy = log_energy;
+        table.xs.value      = values.insert_back(xs.begin(), xs.end());
+        table.edge_bins     = edge_bins.insert_back(bins.begin(), bins.end());
+        CELER_ASSERT(table);
+        tables.push_back(table);
+    }
+
+    CELER_ENSURE(result.materials.size() == materials.num_materials());
+    return result;
+}
+
+//---------------------------------------------------------------------------//
+} // namespace
+
 //---------------------------------------------------------------------------//
 /*!
  * Construct from model ID and other necessary data.
@@ -22,7 +115,9 @@ namespace celeritas
 LivermorePEModel::LivermorePEModel(ModelId               id,
                                    const ParticleParams& particles,
                                    const MaterialParams& materials,
-                                   ReadData              load_data)
+                                   ReadData              load_data,
+                                   bool                  enable_element_cdf,
+                                   bool                  enable_macro_xs_table)
 {
     CELER_EXPECT(id);
     CELER_EXPECT(load_data);
@@ -51,6 +146,49 @@ LivermorePEModel::LivermorePEModel(ModelId               id,
     }
     CELER_ASSERT(host_data.xs.elements.size() == materials.num_elements());
 
+    if (enable_element_cdf)
+    {
+        // Tabulate from the lowest binding energy, below which the cross
+        // sections are constant
+        using AllShells       = AllItems<detail::LivermoreSubshell>;
+        real_type min_binding = std::numeric_limits<real_type>::infinity();
+        for (const auto& shell : host_data.xs.shells[AllShells{}])
+        {
+            min_binding = std::min(min_binding, shell.binding_energy.value());
+        }
+
+        const auto        xs_ref = make_const_ref(host_data);
+        ElementCdfBuilder build_cdf(materials,
+                                    units::MevEnergy{min_binding},
+                                    units::MevEnergy{1e5},
+                                    64);
+        host_data.element_cdf
+            = build_cdf([&](ElementId el_id, units::MevEnergy energy) {
+                  return detail::LivermorePEMicroXsCalculator(xs_ref,
+                                                              energy)(el_id);
+              });
+    }
+
+    if (enable_macro_xs_table)
+    {
+        // Tabulate from 1 keV (below which the structure of the cross
+        // sections near the outer shell edges is too fine to interpolate, and
+        // photons are rarely tracked) up to 1 MeV (which covers the energies
+        // where the physics calculates the cross section on the fly rather
+        // than using the imported tables), with a grid fine enough that
+        // linear interpolation of the steep cross section is accurate
+        constexpr real_type min_energy      = 1e-3;
+        constexpr real_type max_energy      = 1;
+        constexpr size_type bins_per_decade = 128;
+        const auto          num_bins        = static_cast<size_type>(
+            std::ceil(bins_per_decade * std::log10(max_energy / min_energy)));
+        host_data.macro_xs = build_macro_xs(
+            materials,
+            make_const_ref(host_data),
+            UniformGridData::from_bounds(
+                std::log(min_energy), std::log(max_energy), num_bins + 1));
+    }
+
     // Move to mirrored data, copying to device
     data_ = CollectionMirror<detail::LivermorePEData>{std::move(host_data)};
     CELER_ENSURE(this->data_);
@@ -21,6 +21,15 @@ namespace celeritas
 //---------------------------------------------------------------------------//
 /*!
  * Set up and launch the Livermore photoelectric model interaction.
+ *
+ * If \c enable_element_cdf is set, the target element in a material with
+ * more than one element is sampled from probabilities tabulated on a fine
+ * energy grid (to resolve the absorption edges) rather than by evaluating the
+ * cross section of every element in the material at each interaction.
+ *
+ * If \c enable_macro_xs_table is set, the macroscopic cross section used for
+ * low-energy photons is likewise interpolated from a fine per-material table,
+ * except in the grid bins that contain an absorption edge.
  */
 class LivermorePEModel final : public Model
 {
@@ -38,7 +47,9 @@ class LivermorePEModel final : public Model
     LivermorePEModel(ModelId               id,
                      const ParticleParams& particles,
                      const MaterialParams& materials,
-                     ReadData              load_data);
+                     ReadData              load_data,
+                     bool                  enable_element_cdf    = false,
+                     bool                  enable_macro_xs_table = false);
 
     // Particle types and energy ranges that this model applies to
     SetApplicability applicability() const final;
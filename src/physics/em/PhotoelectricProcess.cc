@@ -19,13 +19,17 @@ namespace celeritas
  */
 PhotoelectricProcess::PhotoelectricProcess(SPConstParticles particles,
                                            SPConstMaterials materials,
-                                           SPConstImported  process_data)
+                                           SPConstImported  process_data,
+                                           bool enable_element_cdf,
+                                           bool enable_macro_xs_table)
     : particles_(std::move(particles))
     , materials_(std::move(materials))
     , imported_(process_data,
                 particles_,
                 ImportProcessClass::photoelectric,
                 {pdg::gamma()})
+    , enable_element_cdf_(enable_element_cdf)
+    , enable_macro_xs_table_(enable_macro_xs_table)
 {
     CELER_EXPECT(particles_);
     CELER_EXPECT(materials_);
@@ -39,8 +43,12 @@ auto PhotoelectricProcess::build_models(ModelIdGenerator next_id) const
     -> VecModel
 {
     LivermorePEModel::ReadData load_data = LivermorePEReader();
-    return {std::make_shared<LivermorePEModel>(
-        next_id(), *particles_, *materials_, load_data)};
+    return {std::make_shared<LivermorePEModel>(next_id(),
+                                               *particles_,
+                                               *materials_,
+                                               load_data,
+                                               enable_element_cdf_,
+                                               enable_macro_xs_table_)};
 }
 
 //---------------------------------------------------------------------------//
@@ -33,7 +33,9 @@ class PhotoelectricProcess : public Process
     // Construct from Livermore photoelectric data
     PhotoelectricProcess(SPConstParticles particles,
                          SPConstMaterials materials,
-                         SPConstImported  process_data);
+                         SPConstImported  process_data,
+                         bool             enable_element_cdf    = false,
+                         bool             enable_macro_xs_table = false);
 
     // Construct the models associated with this process
     VecModel build_models(ModelIdGenerator next_id) const final;
@@ -51,6 +53,8 @@ class PhotoelectricProcess : public Process
     SPConstParticles       particles_;
     SPConstMaterials       materials_;
     ImportedProcessAdapter imported_;
+    bool                   enable_element_cdf_;
+    bool                   enable_macro_xs_table_;
 };
 
 //---------------------------------------------------------------------------//
@@ -15,8 +15,11 @@
 #include "base/CollectionBuilder.hh"
 #include "physics/base/PDGNumber.hh"
 #include "physics/base/ParticleParams.hh"
+#include "physics/material/ElementCdfBuilder.hh"
 #include "physics/em/detail/PhysicsConstants.hh"
+#include "physics/em/detail/RBDiffXsCalculator.hh"
 #include "physics/em/detail/RelativisticBremData.hh"
+#include "physics/em/detail/Utils.hh"
 #include "physics/em/generated/RelativisticBremInteract.hh"
 
 #include <cmath>
@@ -30,7 +33,8 @@ namespace celeritas
 RelativisticBremModel::RelativisticBremModel(ModelId               id,
                                              const ParticleParams& particles,
                                              const MaterialParams& materials,
-                                             bool                  enable_lpm)
+                                             bool                  enable_lpm,
+                                             bool enable_element_cdf)
 {
     CELER_EXPECT(id);
 
@@ -53,6 +57,20 @@ RelativisticBremModel::RelativisticBremModel(ModelId               id,
     // Build other data (host_ref.lpm_table, host_ref.elem_data))
     this->build_data(&host_ref, materials, host_ref.electron_mass.value());
 
+    if (enable_element_cdf)
+    {
+        // The complete-screening cross section is independent of energy
+        const auto&       elem_data = host_ref.elem_data;
+        ElementCdfBuilder build_cdf(materials,
+                                    detail::seltzer_berger_limit(),
+                                    detail::high_energy_limit(),
+                                    1);
+        host_ref.element_cdf
+            = build_cdf([&](ElementId el_id, units::MevEnergy) {
+                  return detail::calc_rb_soft_photon_xs(elem_data[el_id]);
+              });
+    }
+
     // Move to mirrored data, copying to device
     data_ = CollectionMirror<detail::RelativisticBremData>{std::move(host_ref)};
     CELER_ENSURE(this->data_);
@@ -121,6 +139,18 @@ void RelativisticBremModel::build_data(HostValue*            data,
         lpm_table.push_back(s_data);
     }
 
+    // Build a table of the Tsai screening functions in the range
+    // [0, data->limit_screen()] with the 1/data->inv_delta_screen() interval
+    auto screen_table = make_builder(&data->screen_table);
+    num_points = data->inv_delta_screen() * data->limit_screen() + 1;
+    screen_table.reserve(num_points);
+
+    for (auto point : range(num_points))
+    {
+        auto x = static_cast<real_type>(point) / data->inv_delta_screen();
+        screen_table.push_back(compute_screen_data(x));
+    }
+
     // Build element data for available elements
     unsigned int num_elements = materials.num_elements();
 
@@ -239,6 +269,18 @@ auto RelativisticBremModel::compute_lpm_data(real_type x) -> MigdalData
     return data;
 }
 
+//---------------------------------------------------------------------------//
+/*!
+ * Compute the coherent and incoherent screening functions at a point.
+ */
+auto RelativisticBremModel::compute_screen_data(real_type x) -> ScreenData
+{
+    ScreenData data;
+    data.phi1 = detail::RBDiffXsCalculator::calc_phi1(x);
+    data.psi1 = detail::RBDiffXsCalculator::calc_psi1(x);
+    return data;
+}
+
 //---------------------------------------------------------------------------//
 /*!
  * Elastic and inelatic form factor using the Dirac-Fock model of atom
@@ -21,6 +21,10 @@ class ParticleParams;
 /*!
  * Set up and launch the relativistic Bremsstrahlung model for high-energy
  * electrons and positrons with the Landau-Pomeranchuk-Migdal (LPM) effect
+ *
+ * If \c enable_element_cdf is set, the target element in a material with
+ * more than one element is sampled from tabulated probabilities weighted by
+ * the complete-screening soft-photon limit of the cross section.
  */
 class RelativisticBremModel final : public Model
 {
@@ -38,7 +42,8 @@ class RelativisticBremModel final : public Model
     RelativisticBremModel(ModelId               id,
                           const ParticleParams& particles,
                           const MaterialParams& materials,
-                          bool                  enable_lpm = true);
+                          bool                  enable_lpm         = true,
+                          bool                  enable_element_cdf = false);
 
     // Particle types and energy ranges that this model applies to
     SetApplicability applicability() const final;
@@ -75,6 +80,7 @@ class RelativisticBremModel final : public Model
     using AtomicNumber = int;
     using FormFactor   = detail::RelBremFormFactor;
     using MigdalData   = detail::RelBremMigdalData;
+    using ScreenData   = detail::RelBremScreenData;
     using ElementData  = detail::RelBremElementData;
 
     //// HELPER FUNCTIONS ////
@@ -85,6 +91,7 @@ class RelativisticBremModel final : public Model
 
     static const FormFactor& get_form_factor(AtomicNumber index);
     MigdalData               compute_lpm_data(real_type shat);
+    ScreenData               compute_screen_data(real_type x);
     ElementData
     compute_element_data(const ElementView& elem, real_type particle_mass);
 };
@@ -8,6 +8,8 @@
 #include "SeltzerBergerModel.hh"
 
 #include <algorithm>
+#include <cmath>
+#include "base/Algorithms.hh"
 #include "base/Assert.hh"
 #include "base/CollectionBuilder.hh"
 #include "comm/Logger.hh"
@@ -15,8 +17,10 @@
 #include "base/Range.hh"
 #include "physics/base/ParticleParams.hh"
 #include "physics/base/PDGNumber.hh"
+#include "physics/material/ElementCdfBuilder.hh"
 #include "physics/material/MaterialParams.hh"
 #include "physics/em/detail/PhysicsConstants.hh"
+#include "physics/em/detail/Utils.hh"
 #include "physics/em/generated/SeltzerBergerInteract.hh"
 
 namespace celeritas
@@ -28,7 +32,9 @@ namespace celeritas
 SeltzerBergerModel::SeltzerBergerModel(ModelId               id,
                                        const ParticleParams& particles,
                                        const MaterialParams& materials,
-                                       ReadData              load_sb_table)
+                                       ReadData              load_sb_table,
+                                       bool enable_sampling_tables,
+                                       bool enable_element_cdf)
 {
     CELER_EXPECT(id);
     CELER_EXPECT(load_sb_table);
@@ -54,11 +60,42 @@ SeltzerBergerModel::SeltzerBergerModel(ModelId               id,
     for (auto el_id : range(ElementId{materials.num_elements()}))
     {
         AtomicNumber z_number = materials.get(el_id).atomic_number();
-        this->append_table(load_sb_table(z_number), &host_data.differential_xs);
+        this->append_table(load_sb_table(z_number),
+                           enable_sampling_tables,
+                           &host_data.differential_xs);
     }
     CELER_ASSERT(host_data.differential_xs.elements.size()
                  == materials.num_elements());
 
+    if (enable_sampling_tables)
+    {
+        // Report the extra memory used by the sampling tables
+        const auto& xs         = host_data.differential_xs;
+        size_type   num_values = 0;
+        for (auto el_id : range(ElementId{xs.elements.size()}))
+        {
+            const detail::SBElementTableData& table = xs.elements[el_id];
+            num_values += table.envelope.size() + table.cdf.size();
+        }
+        CELER_LOG(info) << "Built " << this->label() << " sampling tables for "
+                        << xs.elements.size() << " elements using "
+                        << num_values * sizeof(real_type) / 1024 << " KiB";
+    }
+
+    if (enable_element_cdf)
+    {
+        // Weight elements by the soft-photon limit of the cross section
+        const auto xs_ref = make_const_ref(host_data.differential_xs);
+        ElementCdfBuilder build_cdf(
+            materials, units::MevEnergy{1e-3}, detail::seltzer_berger_limit());
+        host_data.element_cdf
+            = build_cdf([&](ElementId el_id, units::MevEnergy energy) {
+                  return ipow<2>(materials.get(el_id).atomic_number())
+                         * detail::calc_sb_soft_photon_xs(
+                             xs_ref, el_id, energy);
+              });
+    }
+
     // Move to mirrored data, copying to device
     data_ = CollectionMirror<detail::SeltzerBergerData>{std::move(host_data)};
 
@@ -116,9 +153,14 @@ ModelId SeltzerBergerModel::model_id() const
  * Here, x = log of scaled incident energy (E / MeV)
  * and y = scaled exiting energy (E_gamma / E_inc)
  * and values are the cross sections.
+ *
+ * The optional sampling tables bound the linearly interpolated cross section
+ * in each y interval by the larger of its endpoint values, and accumulate the
+ * integral of that envelope over dy/y.
  */
 void SeltzerBergerModel::append_table(const ImportSBTable& imported,
-                                      HostXsTables*        tables) const
+                                      bool          enable_sampling_tables,
+                                      HostXsTables* tables) const
 {
     auto reals = make_builder(&tables->reals);
 
@@ -158,6 +200,26 @@ void SeltzerBergerModel::append_table(const ImportSBTable& imported,
     table.argmax
         = make_builder(&tables->sizes).insert_back(argmax.begin(), argmax.end());
 
+    if (enable_sampling_tables)
+    {
+        std::vector<real_type> envelope(imported.value.size(), 0);
+        std::vector<real_type> cdf(imported.value.size(), 0);
+        for (size_type i : range(num_x))
+        {
+            const double* xs = &imported.value[i * num_y];
+            for (size_type j : range(num_y - 1))
+            {
+                real_type max_xs        = std::max(xs[j], xs[j + 1]);
+                envelope[i * num_y + j] = max_xs;
+                cdf[i * num_y + j + 1]
+                    = cdf[i * num_y + j]
+                      + max_xs * std::log(imported.y[j + 1] / imported.y[j]);
+            }
+        }
+        table.envelope = reals.insert_back(envelope.begin(), envelope.end());
+        table.cdf      = reals.insert_back(cdf.begin(), cdf.end());
+    }
+
     // Add the table
     make_builder(&tables->elements).push_back(table);
 
@@ -165,6 +227,7 @@ void SeltzerBergerModel::append_table(const ImportSBTable& imported,
     CELER_ENSURE(table.grid.y.size() == num_y);
     CELER_ENSURE(table.argmax.size() == num_x);
     CELER_ENSURE(table.grid);
+    CELER_ENSURE(table.has_cdf() == enable_sampling_tables);
 }
 
 //---------------------------------------------------------------------------//
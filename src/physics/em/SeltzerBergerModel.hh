@@ -40,6 +40,17 @@ class ParticleParams;
  * energy spectra from electrons with kinetic energy 1 keV–10 GeV incident on
  * screened nuclei and orbital electrons of neutral atoms with Z = 1–100", At.
  * Data Nucl. Data Tables 35, 345–418.
+ *
+ * If \c enable_sampling_tables is set, a piecewise envelope of the scaled DCS
+ * and its cumulative integral are precalculated for every element and
+ * incident energy grid point, so that the exiting photon energy is sampled by
+ * table inversion (see \c detail::SBCdfEnergyDistribution) rather than by
+ * rejection against the maximum cross section.
+ *
+ * If \c enable_element_cdf is set, the target element in a material with
+ * more than one element is sampled from tabulated probabilities (see
+ * \c TabulatedElementSelector) weighted by \f$ Z^2 \chi(Z, E, \kappa_0) \f$,
+ * the soft-photon limit of the cross section.
  */
 class SeltzerBergerModel final : public Model
 {
@@ -58,7 +69,9 @@ class SeltzerBergerModel final : public Model
     SeltzerBergerModel(ModelId               id,
                        const ParticleParams& particles,
                        const MaterialParams& materials,
-                       ReadData              load_sb_table);
+                       ReadData              load_sb_table,
+                       bool                  enable_sampling_tables = false,
+                       bool                  enable_element_cdf     = false);
 
     // Particle types and energy ranges that this model applies to
     SetApplicability applicability() const final;
@@ -87,7 +100,9 @@ class SeltzerBergerModel final : public Model
 
     using HostXsTables
         = detail::SeltzerBergerTableData<Ownership::value, MemSpace::host>;
-    void append_table(const ImportSBTable& table, HostXsTables* tables) const;
+    void append_table(const ImportSBTable& table,
+                      bool                 enable_sampling_tables,
+                      HostXsTables*        tables) const;
 };
 
 //---------------------------------------------------------------------------//
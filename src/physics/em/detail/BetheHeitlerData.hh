@@ -9,6 +9,7 @@
 
 #include "base/Macros.hh"
 #include "base/Types.hh"
+#include "physics/material/ElementCdfData.hh"
 
 namespace celeritas
 {
@@ -18,6 +19,7 @@ namespace detail
 /*!
  * Device data for creating a BetheHeitlerInteractor.
  */
+template<Ownership W, MemSpace M>
 struct BetheHeitlerData
 {
     //! Model ID
@@ -32,16 +34,37 @@ struct BetheHeitlerData
     //! ID of a gamma
     ParticleId gamma_id;
 
+    //! Optional tabulated element selection probabilities
+    ElementCdfData<W, M> element_cdf;
+
     //! Check whether the view is assigned
     explicit inline CELER_FUNCTION operator bool() const
     {
         return model_id && electron_mass > 0 && electron_id && positron_id
                && gamma_id;
     }
+
+    //! Assign from another set of data
+    template<Ownership W2, MemSpace M2>
+    BetheHeitlerData& operator=(const BetheHeitlerData<W2, M2>& other)
+    {
+        CELER_EXPECT(other);
+        model_id      = other.model_id;
+        electron_mass = other.electron_mass;
+        electron_id   = other.electron_id;
+        positron_id   = other.positron_id;
+        gamma_id      = other.gamma_id;
+        element_cdf   = other.element_cdf;
+        return *this;
+    }
 };
 
-using BetheHeitlerHostRef   = BetheHeitlerData;
-using BetheHeitlerDeviceRef = BetheHeitlerData;
+using BetheHeitlerDeviceRef
+    = BetheHeitlerData<Ownership::const_reference, MemSpace::device>;
+using BetheHeitlerHostRef
+    = BetheHeitlerData<Ownership::const_reference, MemSpace::host>;
+using BetheHeitlerNativeRef
+    = BetheHeitlerData<Ownership::const_reference, MemSpace::native>;
 
 //---------------------------------------------------------------------------//
 } // namespace detail
@@ -45,11 +45,11 @@ class BetheHeitlerInteractor
   public:
     //! Construct sampler from shared and state data
     inline CELER_FUNCTION
-    BetheHeitlerInteractor(const BetheHeitlerData&    shared,
-                           const ParticleTrackView&   particle,
-                           const Real3&               inc_direction,
-                           StackAllocator<Secondary>& allocate,
-                           const ElementView&         element);
+    BetheHeitlerInteractor(const BetheHeitlerNativeRef& shared,
+                           const ParticleTrackView&     particle,
+                           const Real3&                 inc_direction,
+                           StackAllocator<Secondary>&   allocate,
+                           const ElementView&           element);
 
     // Sample an interaction with the given RNG
     template<class Engine>
@@ -59,7 +59,7 @@ class BetheHeitlerInteractor
     //// DATA ////
 
     // Gamma energy divided by electron mass * csquared
-    const BetheHeitlerData& shared_;
+    const BetheHeitlerNativeRef& shared_;
     // Incident gamma energy
     const units::MevEnergy inc_energy_;
     // Incident direction
@@ -17,6 +17,7 @@
 #include "physics/base/Types.hh"
 #include "base/StackAllocator.hh"
 #include "physics/material/MaterialTrackView.hh"
+#include "physics/material/TabulatedElementSelector.hh"
 #include "BetheHeitlerInteractor.hh"
 
 namespace celeritas
@@ -30,14 +31,15 @@ namespace detail
 template<MemSpace M>
 struct BetheHeitlerLauncher
 {
-    CELER_FUNCTION BetheHeitlerLauncher(const BetheHeitlerData&    data,
-                                        const ModelInteractRef<M>& interaction)
+    CELER_FUNCTION
+    BetheHeitlerLauncher(const BetheHeitlerNativeRef& data,
+                         const ModelInteractRef<M>&   interaction)
         : bh(data), model(interaction)
     {
     }
 
-    const BetheHeitlerData&    bh;    //!< Shared data for interactor
-    const ModelInteractRef<M>& model; //!< State data needed to interact
+    const BetheHeitlerNativeRef& bh;    //!< Shared data for interactor
+    const ModelInteractRef<M>&   model; //!< State data needed to interact
 
     //! Create track views and launch interactor
     inline CELER_FUNCTION void operator()(ThreadId tid) const;
@@ -69,17 +71,27 @@ CELER_FUNCTION void BetheHeitlerLauncher<M>::operator()(ThreadId tid) const
     // MaterialTrackView are expensive
     MaterialView material_view = material.material_view();
 
-    // Assume only a single element in the material, for now
-    CELER_ASSERT(material_view.num_elements() == 1);
-    ElementView element
-        = material_view.element_view(celeritas::ElementComponentId{0});
+    // Sample an element from the tabulated probabilities if available, or
+    // assume only a single element in the material
+    RngEngine          rng(model.params.rng, model.states.rng, tid);
+    ElementComponentId selected_element{0};
+    if (bh.element_cdf)
+    {
+        TabulatedElementSelector select_el(
+            bh.element_cdf, material.material_id(), particle.energy());
+        selected_element = select_el(rng);
+    }
+    else
+    {
+        CELER_ASSERT(material_view.num_elements() == 1);
+    }
+    ElementView element = material_view.element_view(selected_element);
     BetheHeitlerInteractor interact(bh,
                                     particle,
                                     model.states.direction[tid],
                                     allocate_secondaries,
                                     element);
 
-    RngEngine rng(model.states.rng, tid);
     model.states.interactions[tid] = interact(rng);
     CELER_ENSURE(model.states.interactions[tid]);
 }
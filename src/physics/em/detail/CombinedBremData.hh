@@ -31,6 +31,9 @@ struct CombinedBremData
     // Device data for RelativisticBrem
     RelativisticBremData<W, M> rb_data;
 
+    //! Optional tabulated element selection probabilities
+    ElementCdfData<W, M> element_cdf;
+
     //! Whether the data is assigned
     explicit inline CELER_FUNCTION operator bool() const
     {
@@ -45,6 +48,7 @@ struct CombinedBremData
         CELER_EXPECT(other);
         sb_differential_xs = other.sb_differential_xs;
         rb_data            = other.rb_data;
+        element_cdf        = other.element_cdf;
         return *this;
     }
 };
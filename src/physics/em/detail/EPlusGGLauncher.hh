@@ -60,7 +60,7 @@ CELER_FUNCTION void EPlusGGLauncher<M>::operator()(ThreadId tid) const
     // Do the interaction
     EPlusGGInteractor interact(
         epgg, particle, model.states.direction[tid], allocate_secondaries);
-    RngEngine rng(model.states.rng, tid);
+    RngEngine rng(model.params.rng, model.states.rng, tid);
     model.states.interactions[tid] = interact(rng);
 
     CELER_ENSURE(model.states.interactions[tid]);
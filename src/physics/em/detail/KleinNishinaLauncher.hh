@@ -62,7 +62,7 @@ CELER_FUNCTION void KleinNishinaLauncher<M>::operator()(ThreadId tid) const
     KleinNishinaInteractor interact(
         kn, particle, model.states.direction[tid], allocate_secondaries);
 
-    RngEngine rng(model.states.rng, tid);
+    RngEngine rng(model.params.rng, model.states.rng, tid);
     model.states.interactions[tid] = interact(rng);
     CELER_ENSURE(model.states.interactions[tid]);
 }
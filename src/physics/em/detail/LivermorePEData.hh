@@ -12,6 +12,7 @@
 #include "base/Quantity.hh"
 #include "physics/base/Units.hh"
 #include "physics/grid/XsGridData.hh"
+#include "physics/material/ElementCdfData.hh"
 
 namespace celeritas
 {
@@ -123,6 +124,66 @@ struct LivermorePEXsData
     }
 };
 
+//---------------------------------------------------------------------------//
+/*!
+ * Tabulated photoelectric macroscopic cross section for a single material.
+ *
+ * The cross section is interpolated on a fine log energy grid except in the
+ * bins that contain a discontinuity in an elemental cross section (an
+ * absorption edge or a change in representation), which are listed in
+ * \c edge_bins and must be calculated exactly.
+ */
+struct LivermorePEMacroXsTable
+{
+    XsGridData           xs;        //!< Macroscopic cross section [1/cm]
+    ItemRange<size_type> edge_bins; //!< Sorted bins with a discontinuity
+
+    //! Whether the table is assigned
+    explicit CELER_FUNCTION operator bool() const { return bool(xs); }
+};
+
+//---------------------------------------------------------------------------//
+/*!
+ * Tabulated photoelectric macroscopic cross sections for all materials.
+ *
+ * This is an optional component of the model data: when it's assigned, the
+ * macroscopic cross section is interpolated instead of summing the
+ * cross sections of every element in the material.
+ */
+template<Ownership W, MemSpace M>
+struct LivermorePEMacroXsData
+{
+    template<class T>
+    using Items = Collection<T, W, M>;
+    template<class T>
+    using MaterialItems = Collection<T, W, M, MaterialId>;
+
+    //// MEMBER DATA ////
+
+    Items<table_real_type>                 values;
+    Items<size_type>                       edge_bins;
+    MaterialItems<LivermorePEMacroXsTable> materials;
+
+    //// MEMBER FUNCTIONS ////
+
+    //! Whether the data is assigned
+    explicit CELER_FUNCTION operator bool() const
+    {
+        return !materials.empty();
+    }
+
+    //! Assign from another set of data (which may be empty)
+    template<Ownership W2, MemSpace M2>
+    LivermorePEMacroXsData&
+    operator=(const LivermorePEMacroXsData<W2, M2>& other)
+    {
+        values    = other.values;
+        edge_bins = other.edge_bins;
+        materials = other.materials;
+        return *this;
+    }
+};
+
 //---------------------------------------------------------------------------//
 /*!
  * Helper struct for making assignment easier
@@ -161,6 +222,12 @@ struct LivermorePEData
     //! Livermore EPICS2014 photoelectric data
     LivermorePEXsData<W, M> xs;
 
+    //! Optional tabulated element selection probabilities
+    ElementCdfData<W, M> element_cdf;
+
+    //! Optional tabulated macroscopic cross sections
+    LivermorePEMacroXsData<W, M> macro_xs;
+
     //// MEMBER FUNCTIONS ////
 
     //! Check whether the data is assigned
@@ -177,6 +244,8 @@ struct LivermorePEData
         ids               = other.ids;
         inv_electron_mass = other.inv_electron_mass;
         xs                = other.xs;
+        element_cdf       = other.element_cdf;
+        macro_xs          = other.macro_xs;
         return *this;
     }
 };
@@ -16,6 +16,7 @@
 #include "physics/base/PhysicsTrackView.hh"
 #include "physics/material/ElementSelector.hh"
 #include "physics/material/MaterialTrackView.hh"
+#include "physics/material/TabulatedElementSelector.hh"
 #include "random/RngEngine.hh"
 #include "LivermorePEInteractor.hh"
 
@@ -62,15 +63,26 @@ CELER_FUNCTION void LivermorePELauncher<M>::operator()(ThreadId tid) const
         return;
 
     CutoffView cutoffs(model.params.cutoffs, material.material_id());
-    RngEngine  rng(model.states.rng, tid);
+    RngEngine  rng(model.params.rng, model.states.rng, tid);
 
-    // Sample an element
-    ElementSelector select_el(
-        material.material_view(),
-        LivermorePEMicroXsCalculator{pe, particle.energy()},
-        material.element_scratch());
-    ElementComponentId comp_id = select_el(rng);
-    ElementId          el_id   = material.material_view().element_id(comp_id);
+    // Sample an element from the tabulated probabilities if available, or
+    // from the microscopic cross sections
+    ElementComponentId comp_id;
+    if (pe.element_cdf)
+    {
+        TabulatedElementSelector select_el(
+            pe.element_cdf, material.material_id(), particle.energy());
+        comp_id = select_el(rng);
+    }
+    else
+    {
+        ElementSelector select_el(
+            material.material_view(),
+            LivermorePEMicroXsCalculator{pe, particle.energy()},
+            material.element_scratch());
+        comp_id = select_el(rng);
+    }
+    ElementId el_id = material.material_view().element_id(comp_id);
 
     AtomicRelaxationHelper relaxation(
         model.params.relaxation, model.states.relaxation, el_id, tid);
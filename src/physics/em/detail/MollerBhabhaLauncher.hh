@@ -69,7 +69,7 @@ CELER_FUNCTION void MollerBhabhaLauncher<M>::operator()(ThreadId tid) const
     MollerBhabhaInteractor interact(
         mb, particle, cutoff, model.states.direction[tid], allocate_secondaries);
 
-    RngEngine rng(model.states.rng, tid);
+    RngEngine rng(model.params.rng, model.states.rng, tid);
     model.states.interactions[tid] = interact(rng);
     CELER_ENSURE(model.states.interactions[tid]);
 }
@@ -78,7 +78,7 @@ CELER_FUNCTION void MuBremsstrahlungLauncher<M>::operator()(ThreadId tid) const
                                         material_view,
                                         elcomp_id);
 
-    RngEngine rng(model.states.rng, tid);
+    RngEngine rng(model.params.rng, model.states.rng, tid);
     model.states.interactions[tid] = interact(rng);
     CELER_ENSURE(model.states.interactions[tid]);
 }
@@ -64,6 +64,12 @@ class RBDiffXsCalculator
         return elem_data_.factor1 + elem_data_.factor2;
     }
 
+    // Calculate Tsai's coherent screening function phi_1
+    static inline CELER_FUNCTION real_type calc_phi1(real_type gamma);
+
+    // Calculate Tsai's incoherent screening function psi_1
+    static inline CELER_FUNCTION real_type calc_psi1(real_type epsilon);
+
   private:
     //// TYPES ////
 
@@ -116,6 +122,10 @@ class RBDiffXsCalculator
 
     //! Compute LPM functions
     inline CELER_FUNCTION LPMFunctions compute_lpm_functions(real_type ss);
+
+    //! Interpolate a tabulated screening function
+    template<class F>
+    inline CELER_FUNCTION real_type interp_screen(real_type x, F get) const;
 };
 
 //---------------------------------------------------------------------------//
@@ -114,27 +114,84 @@ real_type RBDiffXsCalculator::dxsec_per_atom_lpm(real_type gamma_energy)
  * Compute screen_functions: Tsai's analytical approximations of coherent and
  * incoherent screening function to the numerical screening functions computed
  * by using the Thomas-Fermi model: Y.-S.Tsai, Rev. Mod. Phys. 49 (1977) 421.
+ *
+ * The transcendental functions \f$ \phi_1 \f$ and \f$ \psi_1 \f$ are
+ * interpolated from the table built by the model; the screening variables are
+ * almost always small at the energies where this model applies, so the
+ * analytic forms are needed only near the tip of the photon spectrum.
  */
 auto RBDiffXsCalculator::compute_screen_functions(real_type gam, real_type eps)
     -> ScreenFunctions
 {
     ScreenFunctions func;
-    real_type       gam2 = ipow<2>(gam);
-    real_type       eps2 = ipow<2>(eps);
 
-    func.phi1 = R(16.863) - 2 * std::log(1 + R(0.311877) * gam2)
-                + R(2.4) * std::exp(R(-0.9) * gam)
-                + R(1.6) * std::exp(R(-1.5) * gam);
-    func.phi2 = 2 / (3 + R(19.5) * gam + 18 * gam2);
+    func.phi1 = this->interp_screen(
+        gam, [](const RelBremScreenData& d) { return d.phi1; });
+    if (func.phi1 < 0)
+    {
+        func.phi1 = calc_phi1(gam);
+    }
+    func.phi2 = 2 / (3 + R(19.5) * gam + 18 * ipow<2>(gam));
 
-    func.psi1 = R(24.34) - 2 * std::log(1 + R(13.111641) * eps2)
-                + R(2.8) * std::exp(R(-8) * eps)
-                + R(1.2) * std::exp(R(-29.2) * eps);
-    func.psi2 = 2 / (3 + 120 * eps + 1200 * eps2);
+    func.psi1 = this->interp_screen(
+        eps, [](const RelBremScreenData& d) { return d.psi1; });
+    if (func.psi1 < 0)
+    {
+        func.psi1 = calc_psi1(eps);
+    }
+    func.psi2 = 2 / (3 + 120 * eps + 1200 * ipow<2>(eps));
 
     return func;
 }
 
+//---------------------------------------------------------------------------//
+/*!
+ * Linearly interpolate a tabulated screening function.
+ *
+ * The result is -1 if the argument is beyond the table.
+ */
+template<class F>
+CELER_FUNCTION real_type RBDiffXsCalculator::interp_screen(real_type x,
+                                                           F get) const
+{
+    CELER_EXPECT(x >= 0);
+    if (!(x < shared_.limit_screen()))
+    {
+        return -1;
+    }
+
+    real_type val  = x * shared_.inv_delta_screen();
+    size_type ilow = static_cast<size_type>(val);
+    val -= ilow;
+    CELER_ASSERT(ilow + 1 < shared_.screen_table.size());
+
+    real_type lo = get(shared_.screen_table[ItemIdT{ilow}]);
+    real_type hi = get(shared_.screen_table[ItemIdT{ilow + 1}]);
+    return lo + (hi - lo) * val;
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * Calculate Tsai's coherent screening function.
+ */
+CELER_FUNCTION real_type RBDiffXsCalculator::calc_phi1(real_type gam)
+{
+    return R(16.863) - 2 * std::log(1 + R(0.311877) * ipow<2>(gam))
+           + R(2.4) * std::exp(R(-0.9) * gam)
+           + R(1.6) * std::exp(R(-1.5) * gam);
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * Calculate Tsai's incoherent screening function.
+ */
+CELER_FUNCTION real_type RBDiffXsCalculator::calc_psi1(real_type eps)
+{
+    return R(24.34) - 2 * std::log(1 + R(13.111641) * ipow<2>(eps))
+           + R(2.8) * std::exp(R(-8) * eps)
+           + R(1.2) * std::exp(R(-29.2) * eps);
+}
+
 //---------------------------------------------------------------------------//
 /*!
  * Compute the LPM suppression functions.
@@ -63,7 +63,7 @@ CELER_FUNCTION void RayleighLauncher<M>::operator()(ThreadId tid) const
     if (physics.model_id() != rayleigh.model_id)
         return;
 
-    RngEngine rng(model.states.rng, tid);
+    RngEngine rng(model.params.rng, model.states.rng, tid);
 
     // Assume only a single element in the material, for now
     CELER_ASSERT(material.material_view().num_elements() == 1);
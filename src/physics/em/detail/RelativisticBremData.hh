@@ -11,6 +11,7 @@
 #include "base/Collection.hh"
 #include "base/Macros.hh"
 #include "base/Types.hh"
+#include "physics/material/ElementCdfData.hh"
 
 namespace celeritas
 {
@@ -39,6 +40,22 @@ struct RelBremMigdalData
     real_type phis; //!< LPM \phi(s)
 };
 
+//---------------------------------------------------------------------------//
+/*!
+ * Tabulated Tsai screening functions \f$ \phi_1(\gamma) \f$ and \f$
+ * \psi_1(\epsilon) \f$ in the range [0, limit] with an interval \delta, where
+ * limit = 2.0 and \delta = 0.005 by default.
+ *
+ * These are universal functions of the scaled screening variables, and the
+ * only ones in the differential cross section that need transcendental
+ * functions.
+ */
+struct RelBremScreenData
+{
+    real_type phi1; //!< Coherent screening function \phi_1(x)
+    real_type psi1; //!< Incoherent screening function \psi_1(x)
+};
+
 //---------------------------------------------------------------------------//
 /*!
  * A special meta data structure per element used in the differential cross
@@ -99,22 +116,37 @@ struct RelativisticBremData
     using Items = celeritas::Collection<T, W, M, ItemIdT>;
     Items<RelBremMigdalData> lpm_table;
 
+    //! Screening function table
+    Items<RelBremScreenData> screen_table;
+
     //! Element data
     template<class T>
     using ElementItems = celeritas::Collection<T, W, M, ElementId>;
     ElementItems<RelBremElementData> elem_data;
 
+    //! Optional tabulated element selection probabilities
+    ElementCdfData<W, M> element_cdf;
+
     //! Inverse of the interval for evaluating LPM functions
     static CELER_CONSTEXPR_FUNCTION real_type inv_delta_lpm() { return 100.; }
 
     //! The upper limit of the LPM variable for evaluating LPM functions
     static CELER_CONSTEXPR_FUNCTION real_type limit_s_lpm() { return 2.0; }
 
+    //! Inverse of the interval for evaluating screening functions
+    static CELER_CONSTEXPR_FUNCTION real_type inv_delta_screen()
+    {
+        return 200.;
+    }
+
+    //! The upper limit of the screening variables for the table
+    static CELER_CONSTEXPR_FUNCTION real_type limit_screen() { return 2.0; }
+
     //! Check whether the data is assigned
     explicit inline CELER_FUNCTION operator bool() const
     {
         return ids && electron_mass > zero_quantity() && !lpm_table.empty()
-               && !elem_data.empty();
+               && !screen_table.empty() && !elem_data.empty();
     }
 
     //! Assign from another set of data
@@ -126,7 +158,9 @@ struct RelativisticBremData
         electron_mass = other.electron_mass;
         enable_lpm    = other.enable_lpm;
         lpm_table     = other.lpm_table;
+        screen_table  = other.screen_table;
         elem_data     = other.elem_data;
+        element_cdf   = other.element_cdf;
         return *this;
     }
 };
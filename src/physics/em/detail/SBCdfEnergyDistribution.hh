@@ -0,0 +1,112 @@
+//----------------------------------*-C++-*----------------------------------//
+// Copyright 2021 UT-Battelle, LLC, and other Celeritas developers.
+// See the top-level COPYRIGHT file for details.
+// SPDX-License-Identifier: (Apache-2.0 OR MIT)
+//---------------------------------------------------------------------------//
+//! \file SBCdfEnergyDistribution.hh
+//---------------------------------------------------------------------------//
+#pragma once
+
+#include "base/Span.hh"
+#include "physics/base/Units.hh"
+#include "SeltzerBergerData.hh"
+
+namespace celeritas
+{
+namespace detail
+{
+//---------------------------------------------------------------------------//
+/*!
+ * Sample exiting photon energy from Bremsstrahlung using sampling tables.
+ *
+ * This samples the same distribution as \c SBEnergyDistribution,
+ * \f[
+ *   p(k) \propto \chi_Z(E, k/E) \frac{k}{k^2 + d_\rho E^2}
+ * \f]
+ * for \f$ k_c < k < E \f$ (times the optional cross section correction),
+ * but replaces the global \f$ 1/\kappa \f$ proposal and its single bounding
+ * maximum with a piecewise envelope precalculated by \c SeltzerBergerModel.
+ * In each interval \f$ [\kappa_j, \kappa_{j+1}) \f$ of the tabulated reduced
+ * photon energy grid, the envelope is \f$ M_j / \kappa \f$, where \f$ M_j
+ * \f$ is the larger of the two bounding cross sections. Its cumulative
+ * integral \f$ C_j \f$ is stored at every incident energy grid point, and
+ * since both are linear in the tabulated values they can be interpolated in
+ * incident energy along with the cross section itself: the interpolated \f$
+ * M_j \f$ bounds the bilinearly interpolated cross section in each interval
+ * by the triangle inequality.
+ *
+ * The bin containing the cutoff \f$ \kappa_c \f$ is treated separately
+ * because the density correction is significant only at the lowest photon
+ * energies: its envelope is \f$ M_j \kappa / (\kappa^2 + \delta) \f$,
+ * with \f$ \delta = d_\rho \f$ scaled by \f$ E^{-2} \f$, which is
+ * sampled analytically as in \c SBEnergyDistribution. A sample is drawn from
+ * that bin or by inverting the interpolated cumulative envelope of the
+ * higher bins (with a binary search and an analytic \f$ 1/\kappa \f$ sample
+ * inside the selected bin), and then accepted with the probability
+ * \f[
+    \frac{\chi_Z(E, \kappa)}{M_j} \frac{\kappa^2}{\kappa^2 + \delta} s(k)
+ * \f]
+ * where the density factor is omitted in the cutoff bin and \em s is the
+ * cross section correction (bounded by unity for positrons). Each trial uses
+ * two random numbers and a fixed number of table lookups, and since the
+ * envelope closely follows the cross section, nearly all trials are accepted.
+ */
+template<class XSCorrector>
+class SBCdfEnergyDistribution
+{
+  public:
+    //!@{
+    //! Type aliases
+    using SBDXsec
+        = SeltzerBergerTableData<Ownership::const_reference, MemSpace::native>;
+    using Energy   = units::MevEnergy;
+    using EnergySq = Quantity<UnitProduct<units::Mev, units::Mev>>;
+    //!@}
+
+  public:
+    // Construct from data
+    inline CELER_FUNCTION
+    SBCdfEnergyDistribution(const SBDXsec& differential_xs,
+                            Energy         inc_energy,
+                            ElementId      element,
+                            EnergySq       density_correction,
+                            Energy         min_gamma_energy,
+                            XSCorrector    scale_xs);
+
+    // Sample the exiting photon energy
+    template<class Engine>
+    inline CELER_FUNCTION Energy operator()(Engine& rng);
+
+  private:
+    //// IMPLEMENTATION DATA ////
+
+    Span<const real_type> y_grid_;
+    Span<const real_type> xs_;
+    Span<const real_type> envelope_;
+    Span<const real_type> cdf_;
+    size_type             x_index_;
+    real_type             x_frac_;
+    real_type             inc_energy_;
+    real_type             dens_corr_;
+    size_type             min_bin_;
+    real_type             min_kappa_sq_;
+    real_type             min_weight_;
+    real_type             upper_cdf_;
+    real_type             max_cdf_;
+    XSCorrector           scale_xs_;
+
+    //// HELPER FUNCTIONS ////
+
+    // Interpolate tabulated values in incident energy
+    inline CELER_FUNCTION real_type interp(Span<const real_type> values,
+                                           size_type             iy) const;
+
+    // Find the y interval containing the cumulative envelope value
+    inline CELER_FUNCTION size_type find_bin(real_type cdf) const;
+};
+
+//---------------------------------------------------------------------------//
+} // namespace detail
+} // namespace celeritas
+
+#include "SBCdfEnergyDistribution.i.hh"
@@ -0,0 +1,189 @@
+//----------------------------------*-C++-*----------------------------------//
+// Copyright 2021 UT-Battelle, LLC, and other Celeritas developers.
+// See the top-level COPYRIGHT file for details.
+// SPDX-License-Identifier: (Apache-2.0 OR MIT)
+//---------------------------------------------------------------------------//
+//! \file SBCdfEnergyDistribution.i.hh
+//---------------------------------------------------------------------------//
+#include <cmath>
+
+#include "base/Algorithms.hh"
+#include "physics/grid/NonuniformGrid.hh"
+#include "physics/grid/detail/FindInterp.hh"
+#include "random/distributions/BernoulliDistribution.hh"
+#include "random/distributions/GenerateCanonical.hh"
+
+namespace celeritas
+{
+namespace detail
+{
+//---------------------------------------------------------------------------//
+/*!
+ * Construct from incident particle and energy.
+ *
+ * The incident energy *must* be within the bounds of the SB table data, and
+ * the element's sampling tables must have been built.
+ */
+template<class X>
+CELER_FUNCTION SBCdfEnergyDistribution<X>::SBCdfEnergyDistribution(
+    const SBDXsec& differential_xs,
+    Energy         inc_energy,
+    ElementId      element,
+    EnergySq       density_correction,
+    Energy         min_gamma_energy,
+    X              scale_xs)
+    : inc_energy_(inc_energy.value())
+    , dens_corr_(density_correction.value() / ipow<2>(inc_energy.value()))
+    , scale_xs_(::celeritas::move(scale_xs))
+{
+    CELER_EXPECT(element < differential_xs.elements.size());
+    CELER_EXPECT(inc_energy > min_gamma_energy);
+    CELER_EXPECT(min_gamma_energy > zero_quantity());
+
+    const SBElementTableData& el = differential_xs.elements[element];
+    CELER_EXPECT(el.has_cdf());
+    y_grid_   = differential_xs.reals[el.grid.y];
+    xs_       = differential_xs.reals[el.grid.values];
+    envelope_ = differential_xs.reals[el.envelope];
+    cdf_      = differential_xs.reals[el.cdf];
+
+    // Locate the incident energy on the table
+    const NonuniformGrid<real_type> x_grid{el.grid.x, differential_xs.reals};
+    const real_type                 log_energy = std::log(inc_energy_);
+    CELER_ASSERT(log_energy >= x_grid.front() && log_energy < x_grid.back());
+    const auto x_loc = find_interp(x_grid, log_energy);
+    x_index_         = x_loc.index;
+    x_frac_          = x_loc.fraction;
+
+    // Integrate the density-corrected envelope from the cutoff energy to the
+    // top of its bin
+    const NonuniformGrid<real_type> y_grid{el.grid.y, differential_xs.reals};
+    const real_type min_kappa = min_gamma_energy.value() / inc_energy_;
+    CELER_ASSERT(min_kappa >= y_grid.front() && min_kappa < y_grid.back());
+    min_bin_      = y_grid.find(min_kappa);
+    min_kappa_sq_ = ipow<2>(min_kappa) + dens_corr_;
+    min_weight_   = this->interp(envelope_, min_bin_) / 2
+                  * std::log((ipow<2>(y_grid_[min_bin_ + 1]) + dens_corr_)
+                             / min_kappa_sq_);
+
+    // Remaining bins are tabulated
+    upper_cdf_ = this->interp(cdf_, min_bin_ + 1);
+    max_cdf_   = this->interp(cdf_, y_grid_.size() - 1);
+
+    CELER_ENSURE(min_weight_ >= 0 && upper_cdf_ <= max_cdf_);
+    CELER_ENSURE(min_weight_ + max_cdf_ - upper_cdf_ > 0);
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * Sample the exiting energy by inverting the envelope and rejecting.
+ */
+template<class X>
+template<class Engine>
+CELER_FUNCTION auto SBCdfEnergyDistribution<X>::operator()(Engine& rng)
+    -> Energy
+{
+    Energy    exit_energy;
+    real_type accept;
+    do
+    {
+        real_type weight = (min_weight_ + max_cdf_ - upper_cdf_)
+                           * generate_canonical(rng);
+        size_type bin;
+        real_type kappa;
+        real_type dens_factor;
+        if (weight < min_weight_)
+        {
+            // Sample kappa^2 + d from a reciprocal distribution in the
+            // cutoff bin, which accounts for the density correction exactly
+            bin         = min_bin_;
+            kappa       = std::sqrt(min_kappa_sq_
+                                  * std::exp(2 * weight
+                                             / this->interp(envelope_, bin))
+                              - dens_corr_);
+            dens_factor = 1;
+        }
+        else
+        {
+            // Invert the tabulated envelope and sample 1/kappa in the bin
+            real_type cdf = upper_cdf_ + (weight - min_weight_);
+            bin           = this->find_bin(cdf);
+            kappa         = y_grid_[bin]
+                    * std::exp((cdf - this->interp(cdf_, bin))
+                               / this->interp(envelope_, bin));
+            dens_factor = ipow<2>(kappa) / (ipow<2>(kappa) + dens_corr_);
+        }
+        const real_type lower_y = y_grid_[bin];
+        const real_type upper_y = y_grid_[bin + 1];
+        kappa = celeritas::min(celeritas::max(kappa, lower_y), upper_y);
+
+        exit_energy = Energy{kappa * inc_energy_};
+        if (!(exit_energy.value() < inc_energy_))
+        {
+            // Reject the endpoint, which can be reached through roundoff
+            accept = 0;
+            continue;
+        }
+
+        // Bilinearly interpolate the cross section inside the bin
+        real_type y_frac = (kappa - lower_y) / (upper_y - lower_y);
+        real_type xs     = (1 - y_frac) * this->interp(xs_, bin)
+                       + y_frac * this->interp(xs_, bin + 1);
+
+        // Reject on the cross section, density correction, and scaling
+        accept = celeritas::min<real_type>(xs / this->interp(envelope_, bin),
+                                           1)
+                 * dens_factor * scale_xs_(exit_energy);
+        CELER_ASSERT(accept >= 0 && accept <= 1);
+    } while (!BernoulliDistribution(accept)(rng));
+
+    return exit_energy;
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * Interpolate tabulated values in incident energy.
+ */
+template<class X>
+CELER_FUNCTION real_type SBCdfEnergyDistribution<X>::interp(
+    Span<const real_type> values, size_type iy) const
+{
+    const size_type num_y = y_grid_.size();
+    CELER_EXPECT(iy < num_y);
+    CELER_EXPECT((x_index_ + 1) * num_y + iy < values.size());
+    return (1 - x_frac_) * values[x_index_ * num_y + iy]
+           + x_frac_ * values[(x_index_ + 1) * num_y + iy];
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * Find the y interval containing the cumulative envelope value.
+ *
+ * This is the last bin above the cutoff bin whose lower cumulative value does
+ * not exceed the given value, so bins with a zero envelope are never
+ * selected.
+ */
+template<class X>
+CELER_FUNCTION size_type
+SBCdfEnergyDistribution<X>::find_bin(real_type cdf) const
+{
+    size_type lo = min_bin_ + 1;
+    size_type hi = y_grid_.size() - 1;
+    while (hi - lo > 1)
+    {
+        size_type mid = lo + (hi - lo) / 2;
+        if (this->interp(cdf_, mid) <= cdf)
+        {
+            lo = mid;
+        }
+        else
+        {
+            hi = mid;
+        }
+    }
+    return lo;
+}
+
+//---------------------------------------------------------------------------//
+} // namespace detail
+} // namespace celeritas
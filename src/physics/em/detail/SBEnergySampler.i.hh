@@ -12,6 +12,7 @@
 
 #include "PhysicsConstants.hh"
 #include "SBEnergyDistHelper.hh"
+#include "SBCdfEnergyDistribution.hh"
 #include "SBEnergyDistribution.hh"
 #include "SBPositronXsCorrector.hh"
 
@@ -48,6 +49,10 @@ SBEnergySampler::SBEnergySampler(const SBTable&            differential_xs,
 //---------------------------------------------------------------------------//
 /*!
  * Sample the exiting energy by doing a table lookup and rejection.
+ *
+ * If the model built sampling tables, the envelope of the tabulated cross
+ * section is inverted directly; otherwise the 1/k distribution is sampled and
+ * rejected against the maximum cross section.
  */
 template<class Engine>
 CELER_FUNCTION auto SBEnergySampler::operator()(Engine& rng) -> Energy
@@ -55,14 +60,44 @@ CELER_FUNCTION auto SBEnergySampler::operator()(Engine& rng) -> Energy
     // Outgoing photon secondary energy sampler
     Energy gamma_exit_energy;
 
+    const ElementId el_id = material_.element_id(elcomp_id_);
+    const SBEnergyDistHelper::EnergySq dens_corr{density_correction_};
+
+    if (differential_xs_.elements[el_id].has_cdf())
+    {
+        // Sample from the precalculated envelope tables
+        if (inc_particle_is_electron_)
+        {
+            SBCdfEnergyDistribution<SBElectronXsCorrector> sample_gamma_energy(
+                differential_xs_,
+                inc_energy_,
+                el_id,
+                dens_corr,
+                gamma_cutoff_,
+                {});
+            gamma_exit_energy = sample_gamma_energy(rng);
+        }
+        else
+        {
+            SBCdfEnergyDistribution<SBPositronXsCorrector> sample_gamma_energy(
+                differential_xs_,
+                inc_energy_,
+                el_id,
+                dens_corr,
+                gamma_cutoff_,
+                {inc_mass_,
+                 material_.element_view(elcomp_id_),
+                 gamma_cutoff_,
+                 inc_energy_});
+            gamma_exit_energy = sample_gamma_energy(rng);
+        }
+        return gamma_exit_energy;
+    }
+
     // Helper class preprocesses cross section bounds and calculates
     // distribution
     SBEnergyDistHelper sb_helper(
-        differential_xs_,
-        inc_energy_,
-        material_.element_id(elcomp_id_),
-        SBEnergyDistHelper::EnergySq{density_correction_},
-        gamma_cutoff_);
+        differential_xs_, inc_energy_, el_id, dens_corr, gamma_cutoff_);
 
     if (inc_particle_is_electron_)
     {
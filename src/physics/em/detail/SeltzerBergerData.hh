@@ -13,6 +13,7 @@
 #include "physics/base/Types.hh"
 #include "physics/base/Units.hh"
 #include "physics/grid/TwodGridData.hh"
+#include "physics/material/ElementCdfData.hh"
 
 namespace celeritas
 {
@@ -29,6 +30,12 @@ namespace detail
  * \c argmax is the y index of the largest cross section at a given incident
  * energy point.
  *
+ * The optional sampling tables have the same layout as the cross section
+ * values. \c envelope is the larger of the two cross sections bounding each
+ * \em y interval (zero for the last point), and \c cdf is the cumulative
+ * integral of the envelope over \f$ \dif\kappa / \kappa \f$ from the
+ * first \em y point. They are empty unless tabulated sampling is enabled.
+ *
  * \todo We could use way smaller integers for argmax, even i/j here, because
  * these tables are so small.
  */
@@ -37,12 +44,19 @@ struct SBElementTableData
     using EnergyUnits = units::LogMev;
     using XsUnits     = units::Millibarn;
 
-    TwodGridData         grid;   //!< Cross section grid and data
-    ItemRange<size_type> argmax; //!< Y index of the largest XS for each energy
+    TwodGridData         grid;     //!< Cross section grid and data
+    ItemRange<size_type> argmax;   //!< Y index of the largest XS at each E
+    ItemRange<real_type> envelope; //!< Bounding XS in each y interval
+    ItemRange<real_type> cdf;      //!< Integral of the envelope over dk/k
+
+    //! Whether the sampling tables are present
+    CELER_FUNCTION bool has_cdf() const { return !cdf.empty(); }
 
     explicit inline CELER_FUNCTION operator bool() const
     {
-        return grid && argmax.size() == grid.x.size();
+        return grid && argmax.size() == grid.x.size()
+               && envelope.size() == cdf.size()
+               && (cdf.empty() || cdf.size() == grid.values.size());
     }
 };
 
@@ -130,6 +144,9 @@ struct SeltzerBergerData
     // Differential cross section storage
     SeltzerBergerTableData<W, M> differential_xs;
 
+    //! Optional tabulated element selection probabilities
+    ElementCdfData<W, M> element_cdf;
+
     //// MEMBER FUNCTIONS ////
 
     //! Whether the data is assigned
@@ -146,6 +163,7 @@ struct SeltzerBergerData
         ids             = other.ids;
         electron_mass   = other.electron_mass;
         differential_xs = other.differential_xs;
+        element_cdf     = other.element_cdf;
         return *this;
     }
 };
@@ -15,6 +15,7 @@
 #include "physics/base/ParticleTrackView.hh"
 #include "physics/base/PhysicsTrackView.hh"
 #include "physics/material/MaterialTrackView.hh"
+#include "physics/material/TabulatedElementSelector.hh"
 #include "random/RngEngine.hh"
 #include "SeltzerBergerInteractor.hh"
 
@@ -64,10 +65,22 @@ CELER_FUNCTION void SeltzerBergerLauncher<M>::operator()(ThreadId tid) const
     if (physics.model_id() != sb.ids.model)
         return;
 
-    // Assume only a single element in the material, for now
+    RngEngine    rng(model.params.rng, model.states.rng, tid);
     MaterialView material_view = material.material_view();
-    CELER_ASSERT(material_view.num_elements() == 1);
-    const ElementComponentId selected_element{0};
+
+    // Sample an element from the tabulated probabilities if available, or
+    // assume only a single element in the material
+    ElementComponentId selected_element{0};
+    if (sb.element_cdf)
+    {
+        TabulatedElementSelector select_el(
+            sb.element_cdf, material.material_id(), particle.energy());
+        selected_element = select_el(rng);
+    }
+    else
+    {
+        CELER_ASSERT(material_view.num_elements() == 1);
+    }
 
     CutoffView cutoffs(model.params.cutoffs, material.material_id());
     StackAllocator<Secondary> allocate_secondaries(model.states.secondaries);
@@ -79,7 +92,6 @@ CELER_FUNCTION void SeltzerBergerLauncher<M>::operator()(ThreadId tid) const
                                      material_view,
                                      selected_element);
 
-    RngEngine rng(model.states.rng, tid);
     model.states.interactions[tid] = interact(rng);
     CELER_ENSURE(model.states.interactions[tid]);
 }
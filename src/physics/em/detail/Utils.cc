@@ -10,6 +10,8 @@
 #include <cmath>
 #include "base/Algorithms.hh"
 #include "base/Range.hh"
+#include "physics/grid/NonuniformGrid.hh"
+#include "physics/grid/detail/FindInterp.hh"
 
 namespace celeritas
 {
@@ -176,6 +178,55 @@ size_type calc_max_stack_size(const MaxSecondariesCalculator::Values& data,
     return MaxStackSizeCalculator(data, shells)();
 }
 
+//---------------------------------------------------------------------------//
+/*!
+ * Interpolate the soft-photon limit of a scaled SB cross section.
+ *
+ * This is the tabulated value \f$ \chi_Z(E, \kappa_0) \f$ at the lowest
+ * reduced photon energy, linearly interpolated in log incident energy and
+ * clamped to the table bounds. Multiplied by \f$ Z^2 \f$ it approximates the
+ * relative bremsstrahlung cross section of the element, neglecting the
+ * dependence on the photon production cutoff.
+ */
+real_type calc_sb_soft_photon_xs(
+    const SeltzerBergerTableData<Ownership::const_reference, MemSpace::host>&
+                     xs,
+    ElementId        element,
+    units::MevEnergy energy)
+{
+    CELER_EXPECT(element < xs.elements.size());
+    CELER_EXPECT(energy > zero_quantity());
+
+    const SBElementTableData&       table = xs.elements[element];
+    const NonuniformGrid<real_type> x_grid{table.grid.x, xs.reals};
+    const size_type                 num_y  = table.grid.y.size();
+    const auto                      values = xs.reals[table.grid.values];
+
+    const real_type log_energy = celeritas::min(
+        celeritas::max(std::log(energy.value()), x_grid.front()),
+        x_grid.back());
+    if (log_energy == x_grid.back())
+    {
+        return values[(x_grid.size() - 1) * num_y];
+    }
+    const auto loc = find_interp(x_grid, log_energy);
+    return (1 - loc.fraction) * values[loc.index * num_y]
+           + loc.fraction * values[(loc.index + 1) * num_y];
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * Calculate the soft-photon limit of the relativistic brems cross section.
+ *
+ * This is \f$ k d\sigma/dk \f$ in the complete-screening approximation (in
+ * arbitrary units) as the photon energy goes to zero. It's independent of the
+ * incident energy, and it neglects the LPM suppression.
+ */
+real_type calc_rb_soft_photon_xs(const RelBremElementData& element)
+{
+    return ipow<2>(element.iz) * (element.factor1 + element.factor2);
+}
+
 //---------------------------------------------------------------------------//
 } // namespace detail
 } // namespace celeritas
@@ -10,7 +10,10 @@
 #include <unordered_map>
 #include "base/Macros.hh"
 #include "base/Types.hh"
+#include "physics/base/Units.hh"
 #include "physics/em/AtomicRelaxationData.hh"
+#include "RelativisticBremData.hh"
+#include "SeltzerBergerData.hh"
 
 namespace celeritas
 {
@@ -98,6 +101,16 @@ size_type calc_max_secondaries(const MaxSecondariesCalculator::Values& data,
 size_type calc_max_stack_size(const MaxStackSizeCalculator::Values& data,
                               const ItemRange<AtomicRelaxSubshell>& shells);
 
+// Interpolate the soft-photon limit of a scaled SB cross section
+real_type calc_sb_soft_photon_xs(
+    const SeltzerBergerTableData<Ownership::const_reference, MemSpace::host>&
+                     xs,
+    ElementId        element,
+    units::MevEnergy energy);
+
+// Calculate the soft-photon limit of the relativistic brems cross section
+real_type calc_rb_soft_photon_xs(const RelBremElementData& element);
+
 //---------------------------------------------------------------------------//
 } // namespace detail
 } // namespace celeritas
@@ -24,9 +24,9 @@ void eplusgg_interact(
 
     detail::EPlusGGLauncher<MemSpace::host> launch(eplusgg_data, model);
     #pragma omp parallel for
-    for (size_type i = 0; i < model.states.size(); ++i)
+    for (size_type i = 0; i < model.num_threads(); ++i)
     {
-        ThreadId tid{i};
+        ThreadId tid = model.track_slot(ThreadId{i});
         launch(tid);
     }
 }
@@ -23,11 +23,11 @@ __global__ void klein_nishina_interact_kernel(
     const ModelInteractRef<MemSpace::device> model)
 {
     auto tid = KernelParamCalculator::thread_id();
-    if (!(tid < model.states.size()))
+    if (!(tid < model.num_threads()))
         return;
 
     detail::KleinNishinaLauncher<MemSpace::device> launch(klein_nishina_data, model);
-    launch(tid);
+    launch(model.track_slot(tid));
 }
 } // namespace
 
@@ -40,7 +40,7 @@ void klein_nishina_interact(
 
     static const KernelParamCalculator calc_kernel_params(
         klein_nishina_interact_kernel, "klein_nishina_interact");
-    auto params = calc_kernel_params(model.states.size());
+    auto params = calc_kernel_params(model.num_threads());
     klein_nishina_interact_kernel<<<params.grid_size, params.block_size>>>(
         klein_nishina_data, model);
     CELER_CUDA_CHECK_ERROR();
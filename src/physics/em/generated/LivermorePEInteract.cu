@@ -23,11 +23,11 @@ __global__ void livermore_pe_interact_kernel(
     const ModelInteractRef<MemSpace::device> model)
 {
     auto tid = KernelParamCalculator::thread_id();
-    if (!(tid < model.states.size()))
+    if (!(tid < model.num_threads()))
         return;
 
     detail::LivermorePELauncher<MemSpace::device> launch(livermore_pe_data, model);
-    launch(tid);
+    launch(model.track_slot(tid));
 }
 } // namespace
 
@@ -40,7 +40,7 @@ void livermore_pe_interact(
 
     static const KernelParamCalculator calc_kernel_params(
         livermore_pe_interact_kernel, "livermore_pe_interact");
-    auto params = calc_kernel_params(model.states.size());
+    auto params = calc_kernel_params(model.num_threads());
     livermore_pe_interact_kernel<<<params.grid_size, params.block_size>>>(
         livermore_pe_data, model);
     CELER_CUDA_CHECK_ERROR();
@@ -23,11 +23,11 @@ __global__ void moller_bhabha_interact_kernel(
     const ModelInteractRef<MemSpace::device> model)
 {
     auto tid = KernelParamCalculator::thread_id();
-    if (!(tid < model.states.size()))
+    if (!(tid < model.num_threads()))
         return;
 
     detail::MollerBhabhaLauncher<MemSpace::device> launch(moller_bhabha_data, model);
-    launch(tid);
+    launch(model.track_slot(tid));
 }
 } // namespace
 
@@ -40,7 +40,7 @@ void moller_bhabha_interact(
 
     static const KernelParamCalculator calc_kernel_params(
         moller_bhabha_interact_kernel, "moller_bhabha_interact");
-    auto params = calc_kernel_params(model.states.size());
+    auto params = calc_kernel_params(model.num_threads());
     moller_bhabha_interact_kernel<<<params.grid_size, params.block_size>>>(
         moller_bhabha_data, model);
     CELER_CUDA_CHECK_ERROR();
@@ -23,11 +23,11 @@ __global__ void relativistic_brem_interact_kernel(
     const ModelInteractRef<MemSpace::device> model)
 {
     auto tid = KernelParamCalculator::thread_id();
-    if (!(tid < model.states.size()))
+    if (!(tid < model.num_threads()))
         return;
 
     detail::RelativisticBremLauncher<MemSpace::device> launch(relativistic_brem_data, model);
-    launch(tid);
+    launch(model.track_slot(tid));
 }
 } // namespace
 
@@ -40,7 +40,7 @@ void relativistic_brem_interact(
 
     static const KernelParamCalculator calc_kernel_params(
         relativistic_brem_interact_kernel, "relativistic_brem_interact");
-    auto params = calc_kernel_params(model.states.size());
+    auto params = calc_kernel_params(model.num_threads());
     relativistic_brem_interact_kernel<<<params.grid_size, params.block_size>>>(
         relativistic_brem_data, model);
     CELER_CUDA_CHECK_ERROR();
@@ -23,11 +23,11 @@ __global__ void seltzer_berger_interact_kernel(
     const ModelInteractRef<MemSpace::device> model)
 {
     auto tid = KernelParamCalculator::thread_id();
-    if (!(tid < model.states.size()))
+    if (!(tid < model.num_threads()))
         return;
 
     detail::SeltzerBergerLauncher<MemSpace::device> launch(seltzer_berger_data, model);
-    launch(tid);
+    launch(model.track_slot(tid));
 }
 } // namespace
 
@@ -40,7 +40,7 @@ void seltzer_berger_interact(
 
     static const KernelParamCalculator calc_kernel_params(
         seltzer_berger_interact_kernel, "seltzer_berger_interact");
-    auto params = calc_kernel_params(model.states.size());
+    auto params = calc_kernel_params(model.num_threads());
     seltzer_berger_interact_kernel<<<params.grid_size, params.block_size>>>(
         seltzer_berger_data, model);
     CELER_CUDA_CHECK_ERROR();
@@ -0,0 +1,91 @@
+//----------------------------------*-C++-*----------------------------------//
+// Copyright 2021 UT-Battelle, LLC, and other Celeritas developers.
+// See the top-level COPYRIGHT file for details.
+// SPDX-License-Identifier: (Apache-2.0 OR MIT)
+//---------------------------------------------------------------------------//
+//! \file EnergyLookupCache.hh
+//---------------------------------------------------------------------------//
+#pragma once
+
+#include "base/Array.hh"
+#include "base/Macros.hh"
+#include "base/Quantity.hh"
+#include "base/Types.hh"
+#include "physics/base/Units.hh"
+#include "UniformGridData.hh"
+
+namespace celeritas
+{
+//---------------------------------------------------------------------------//
+/*!
+ * Cache the location of a single energy on uniform log-energy grids.
+ *
+ * The physics tables for a particle usually share a few distinct energy
+ * grids, so evaluating every cross section and range table at the same energy
+ * repeats the same \c std::log, bin search, and \c std::exp of the bin
+ * endpoints. This class calculates the log of the energy once at
+ * construction and remembers the bin and its bounding energies for the most
+ * recently used grids, which are identified by their parameters rather than
+ * their storage.
+ *
+ * It is meant to be constructed locally for a track's energy and passed to
+ * the grid calculators:
+ * \code
+    EnergyLookupCache lookup(particle.energy());
+    real_type xs = calc_xs(lookup);
+    real_type range = calc_range(lookup);
+   \endcode
+ */
+class EnergyLookupCache
+{
+  public:
+    //!@{
+    //! Type aliases
+    using Energy = Quantity<units::Mev>;
+    //!@}
+
+    //! Location of the energy inside a grid
+    struct Location
+    {
+        size_type index;        //!< Lower grid point
+        real_type lower_energy; //!< Energy of the lower grid point
+        real_type upper_energy; //!< Energy of the upper grid point
+    };
+
+  public:
+    // Construct with the energy to look up
+    explicit inline CELER_FUNCTION EnergyLookupCache(Energy energy);
+
+    //! Energy being looked up
+    CELER_FUNCTION Energy energy() const { return energy_; }
+
+    //! Log of the energy
+    CELER_FUNCTION real_type log_energy() const { return log_energy_; }
+
+    // Find the energy on a grid (must be inside the grid bounds)
+    inline CELER_FUNCTION const Location& find(const UniformGridData& grid);
+
+  private:
+    //// TYPES ////
+
+    static constexpr size_type max_grids = 4;
+
+    struct Entry
+    {
+        UniformGridData grid;
+        Location        location;
+    };
+
+    //// DATA ////
+
+    Energy                  energy_;
+    real_type               log_energy_;
+    size_type               num_entries_{0};
+    size_type               next_entry_{0};
+    Array<Entry, max_grids> entries_;
+};
+
+//---------------------------------------------------------------------------//
+} // namespace celeritas
+
+#include "EnergyLookupCache.i.hh"
@@ -0,0 +1,63 @@
+//----------------------------------*-C++-*----------------------------------//
+// Copyright 2021 UT-Battelle, LLC, and other Celeritas developers.
+// See the top-level COPYRIGHT file for details.
+// SPDX-License-Identifier: (Apache-2.0 OR MIT)
+//---------------------------------------------------------------------------//
+//! \file EnergyLookupCache.i.hh
+//---------------------------------------------------------------------------//
+#include <cmath>
+
+#include "base/Assert.hh"
+#include "UniformGrid.hh"
+
+namespace celeritas
+{
+//---------------------------------------------------------------------------//
+/*!
+ * Construct with the energy to look up.
+ */
+CELER_FUNCTION EnergyLookupCache::EnergyLookupCache(Energy energy)
+    : energy_(energy), log_energy_(std::log(energy.value()))
+{
+    CELER_EXPECT(energy >= zero_quantity());
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * Find the energy on a grid, reusing the result for identical grids.
+ *
+ * The log energy *must* be inside the grid: out-of-bounds values usually
+ * need special treatment by the caller.
+ */
+CELER_FUNCTION auto EnergyLookupCache::find(const UniformGridData& grid)
+    -> const Location&
+{
+    for (size_type i = 0; i < num_entries_; ++i)
+    {
+        const UniformGridData& cached = entries_[i].grid;
+        if (cached.size == grid.size && cached.front == grid.front
+            && cached.delta == grid.delta)
+        {
+            return entries_[i].location;
+        }
+    }
+
+    // Replace the oldest entry if the cache is full
+    Entry& entry = entries_[next_entry_];
+    next_entry_  = (next_entry_ + 1) % max_grids;
+    if (num_entries_ < max_grids)
+    {
+        ++num_entries_;
+    }
+
+    const UniformGrid loge_grid(grid);
+    const size_type   index = loge_grid.find(log_energy_);
+    entry.grid              = grid;
+    entry.location          = {index,
+                      std::exp(loge_grid[index]),
+                      std::exp(loge_grid[index + 1])};
+    return entry.location;
+}
+
+//---------------------------------------------------------------------------//
+} // namespace celeritas
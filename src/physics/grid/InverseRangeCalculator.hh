@@ -39,8 +39,9 @@ class InverseRangeCalculator
     //!@{
     //! Type aliases
     using Energy = Quantity<XsGridData::EnergyUnits>;
-    using Values
-        = Collection<real_type, Ownership::const_reference, MemSpace::native>;
+    using Values = Collection<table_real_type,
+                              Ownership::const_reference,
+                              MemSpace::native>;
     //!@}
 
   public:
@@ -52,8 +53,8 @@ class InverseRangeCalculator
     inline CELER_FUNCTION Energy operator()(real_type range) const;
 
   private:
-    UniformGrid               log_energy_;
-    NonuniformGrid<real_type> range_;
+    UniformGrid                     log_energy_;
+    NonuniformGrid<table_real_type> range_;
 };
 
 //---------------------------------------------------------------------------//
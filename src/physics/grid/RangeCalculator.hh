@@ -9,6 +9,7 @@
 
 #include "base/Collection.hh"
 #include "base/Quantity.hh"
+#include "EnergyLookupCache.hh"
 #include "XsGridData.hh"
 
 namespace celeritas
@@ -33,8 +34,9 @@ class RangeCalculator
     //!@{
     //! Type aliases
     using Energy = Quantity<XsGridData::EnergyUnits>;
-    using Values
-        = Collection<real_type, Ownership::const_reference, MemSpace::native>;
+    using Values = Collection<table_real_type,
+                              Ownership::const_reference,
+                              MemSpace::native>;
     //!@}
 
   public:
@@ -45,6 +47,9 @@ class RangeCalculator
     // Find and interpolate from the energy
     inline CELER_FUNCTION real_type operator()(Energy energy) const;
 
+    // Find and interpolate from a cached energy lookup
+    inline CELER_FUNCTION real_type operator()(EnergyLookupCache& lookup) const;
+
   private:
     const XsGridData& data_;
     const Values&     reals_;
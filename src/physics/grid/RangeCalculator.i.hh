@@ -30,9 +30,20 @@ RangeCalculator::RangeCalculator(const XsGridData& grid, const Values& values)
  * Calculate the range.
  */
 CELER_FUNCTION real_type RangeCalculator::operator()(Energy energy) const
+{
+    EnergyLookupCache lookup(energy);
+    return (*this)(lookup);
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * Calculate the range, reusing the log energy and grid location.
+ */
+CELER_FUNCTION real_type
+RangeCalculator::operator()(EnergyLookupCache& lookup) const
 {
     UniformGrid     loge_grid(data_.log_energy);
-    const real_type loge = std::log(energy.value());
+    const real_type loge = lookup.log_energy();
 
     if (loge <= loge_grid.front())
     {
@@ -48,14 +59,14 @@ CELER_FUNCTION real_type RangeCalculator::operator()(Energy energy) const
     }
 
     // Locate the energy bin
-    auto idx = loge_grid.find(loge);
-    CELER_ASSERT(idx + 1 < loge_grid.size());
+    const auto& loc = lookup.find(data_.log_energy);
+    CELER_ASSERT(loc.index + 1 < loge_grid.size());
 
     // Interpolate *linearly* on energy
     LinearInterpolator<real_type> interpolate_xs(
-        {std::exp(loge_grid[idx]), this->get(idx)},
-        {std::exp(loge_grid[idx + 1]), this->get(idx + 1)});
-    return interpolate_xs(energy.value());
+        {loc.lower_energy, this->get(loc.index)},
+        {loc.upper_energy, this->get(loc.index + 1)});
+    return interpolate_xs(lookup.energy().value());
 }
 
 //---------------------------------------------------------------------------//
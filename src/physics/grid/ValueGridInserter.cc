@@ -7,21 +7,185 @@
 //---------------------------------------------------------------------------//
 #include "ValueGridInserter.hh"
 
+#include "celeritas_config.h"
+#include <algorithm>
+#include <cmath>
+#include <functional>
+#include "base/Range.hh"
 #include "base/SpanRemapper.hh"
 #include "base/VectorUtils.hh"
 #include "comm/Device.hh"
+#include "Interpolator.hh"
+#include "InverseRangeCalculator.hh"
+#include "UniformGrid.hh"
+#include "XsCalculator.hh"
 
 namespace celeritas
 {
+namespace
+{
+//---------------------------------------------------------------------------//
+/*!
+ * Combine the hashes of the grid values.
+ */
+std::size_t hash_values(Span<const table_real_type> values)
+{
+    std::hash<table_real_type> hash_real;
+    std::size_t                result = values.size();
+    for (table_real_type v : values)
+    {
+        result ^= hash_real(v) + 0x9e3779b9u + (result << 6) + (result >> 2);
+    }
+    return result;
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * Whether two uniform grids are identical.
+ */
+bool same_grid(const UniformGridData& a, const UniformGridData& b)
+{
+    return a.size == b.size && a.front == b.front && a.back == b.back
+           && a.delta == b.delta;
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * Relative deviation of a value from a nonzero reference.
+ */
+real_type calc_rel_deviation(real_type actual, real_type expected)
+{
+    return expected != 0 ? std::fabs(actual - expected) / std::fabs(expected)
+                         : 0;
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * Whether values are strictly increasing.
+ */
+template<class T>
+bool is_increasing(Span<const T> values)
+{
+    return std::adjacent_find(
+               values.begin(), values.end(), std::greater_equal<T>())
+           == values.end();
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * Compare lookups in a stored grid against double precision.
+ *
+ * The stored values are looked up with \c XsCalculator and
+ * \c InverseRangeCalculator, and the reference is the same linear
+ * interpolation of the unconverted input values. Values are compared at every
+ * node and interval midpoint. For increasing grids without 1/E scaling (i.e.
+ * range tables), the energy from an inverse range lookup is compared at the
+ * same points in range.
+ */
+ValueGridInserter::LookupDeviation
+calc_lookup_deviation(const UniformGridData&      log_grid,
+                      size_type                   prime_index,
+                      Span<const table_real_type> stored,
+                      Span<const real_type>       values)
+{
+    using Energy = XsCalculator::Energy;
+    using Values = XsCalculator::Values;
+
+    ValueGridInserter::RealCollection storage;
+    XsGridData                        grid;
+    grid.log_energy  = log_grid;
+    grid.prime_index = prime_index;
+    grid.value
+        = make_builder(&storage).insert_back(stored.begin(), stored.end());
+    Values stored_ref;
+    stored_ref = storage;
+
+    const UniformGrid      loge_grid(log_grid);
+    std::vector<real_type> energy(loge_grid.size());
+    for (auto i : range(energy.size()))
+    {
+        energy[i] = std::exp(loge_grid[i]);
+    }
+
+    ValueGridInserter::LookupDeviation result;
+    const XsCalculator                 calc_xs(grid, stored_ref);
+    for (auto i : range(energy.size() - 1))
+    {
+        real_type upper = values[i + 1];
+        if (i + 1 == prime_index)
+        {
+            upper /= energy[i + 1];
+        }
+        LinearInterpolator<real_type> interpolate({energy[i], values[i]},
+                                                  {energy[i + 1], upper});
+        for (real_type frac : {real_type(0), real_type(0.5)})
+        {
+            real_type e = std::exp(loge_grid[i] + frac * log_grid.delta);
+            real_type expected = interpolate(e);
+            if (i >= prime_index)
+            {
+                expected /= e;
+            }
+            result.value = std::max(
+                result.value, calc_rel_deviation(calc_xs(Energy{e}), expected));
+        }
+    }
+
+    if (prime_index != XsGridData::no_scaling() || !is_increasing(stored)
+        || !is_increasing(values))
+    {
+        return result;
+    }
+
+    // Compare inverse lookups over the range covered by both tables
+    const InverseRangeCalculator calc_energy(grid, stored_ref);
+    const real_type lower = std::max<real_type>(stored.front(), values.front());
+    const real_type upper = std::min<real_type>(stored.back(), values.back());
+    for (auto i : range(values.size() - 1))
+    {
+        for (real_type frac : {real_type(0), real_type(0.5)})
+        {
+            real_type r = values[i] + frac * (values[i + 1] - values[i]);
+            r           = std::min(std::max(r, lower), upper);
+
+            // Find the reference interval containing the clamped range
+            size_type j = std::upper_bound(values.begin(), values.end(), r)
+                          - values.begin();
+            j = std::min<size_type>(std::max<size_type>(j, 1),
+                                    values.size() - 1);
+            LinearInterpolator<real_type> interpolate(
+                {values[j - 1], energy[j - 1]}, {values[j], energy[j]});
+            result.inverse = std::max(
+                result.inverse,
+                calc_rel_deviation(calc_energy(r).value(), interpolate(r)));
+        }
+    }
+    return result;
+}
+
+//---------------------------------------------------------------------------//
+} // namespace
+
 //---------------------------------------------------------------------------//
 /*!
  * Construct with a reference to mutable host data.
  */
 ValueGridInserter::ValueGridInserter(RealCollection*   real_data,
                                      XsGridCollection* xs_grid)
-    : values_(real_data), xs_grids_(xs_grid)
+    : real_data_(real_data)
+    , xs_grid_data_(xs_grid)
+    , values_(real_data)
+    , xs_grids_(xs_grid)
+    , lookup_(std::make_shared<GridLookup>())
 {
     CELER_EXPECT(real_data && xs_grid);
+
+    // Index existing grids for reuse
+    for (auto grid_id : range(XsIndex{xs_grid->size()}))
+    {
+        lookup_->grids.insert(
+            {hash_values((*real_data)[(*xs_grid)[grid_id].value]), grid_id});
+    }
 }
 
 //---------------------------------------------------------------------------//
@@ -40,8 +204,59 @@ auto ValueGridInserter::operator()(const UniformGridData& log_grid,
     XsGridData grid;
     grid.log_energy  = log_grid;
     grid.prime_index = prime_index;
-    grid.value       = values_.insert_back(values.begin(), values.end());
-    return xs_grids_.push_back(grid);
+
+    // Convert to the storage type
+    std::vector<table_real_type> stored(values.begin(), values.end());
+    Span<const table_real_type>  new_values = make_span(stored);
+    if (CELERITAS_SINGLE_PRECISION_TABLES)
+    {
+        auto  deviation = calc_lookup_deviation(
+            log_grid, prime_index, new_values, values);
+        auto& max_dev   = lookup_->max_deviation;
+        max_dev.value   = std::max(max_dev.value, deviation.value);
+        max_dev.inverse = std::max(max_dev.inverse, deviation.inverse);
+    }
+
+    // Look for an existing grid with the same values
+    const std::size_t key          = hash_values(new_values);
+    auto              equal_values = lookup_->grids.equal_range(key);
+    for (auto iter = equal_values.first; iter != equal_values.second; ++iter)
+    {
+        const XsGridData& existing        = (*xs_grid_data_)[iter->second];
+        auto              existing_values = (*real_data_)[existing.value];
+        if (!std::equal(new_values.begin(),
+                        new_values.end(),
+                        existing_values.begin(),
+                        existing_values.end()))
+        {
+            continue;
+        }
+
+        if (existing.prime_index == prime_index
+            && same_grid(existing.log_energy, log_grid))
+        {
+            // Reuse the entire grid
+            lookup_->bytes_saved += new_values.size() * sizeof(table_real_type)
+                                    + sizeof(XsGridData);
+            return iter->second;
+        }
+
+        // Reuse the values with a different energy grid or scaling, but keep
+        // looking for an identical grid
+        grid.value = existing.value;
+    }
+
+    if (grid.value.empty())
+    {
+        grid.value = values_.insert_back(new_values.begin(), new_values.end());
+    }
+    else
+    {
+        lookup_->bytes_saved += new_values.size() * sizeof(table_real_type);
+    }
+    XsIndex result = xs_grids_.push_back(grid);
+    lookup_->grids.insert({key, result});
+    return result;
 }
 
 //---------------------------------------------------------------------------//
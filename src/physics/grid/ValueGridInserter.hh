@@ -7,6 +7,9 @@
 //---------------------------------------------------------------------------//
 #pragma once
 
+#include <cstddef>
+#include <memory>
+#include <unordered_map>
 #include <vector>
 #include "base/Collection.hh"
 #include "base/CollectionBuilder.hh"
@@ -25,6 +28,18 @@ namespace celeritas
  * ValueGridXsBuilder::build method taking an instance of this class) it can be
  * extended to build additional grid types as well.
  *
+ * Grids whose values are identical to those of an earlier grid (e.g. for
+ * materials that differ only by name) share storage: if the energy grid and
+ * scaling also match, the existing grid ID is returned; otherwise a new grid
+ * is created that references the existing values. Grids already present in
+ * the collections at construction are candidates for reuse as well. Copies
+ * of an inserter share the lookup table of stored grids.
+ *
+ * Values are converted to \c table_real_type on insertion. If that is single
+ * precision, the cross section and inverse range lookups in each inserted
+ * grid are compared against the same interpolation in double precision, and
+ * the largest relative deviations are recorded.
+ *
  * \code
     ValueGridInserter insert(&data.host.values, &data.host.grids);
     insert(uniform_grid, values);
@@ -38,7 +53,7 @@ class ValueGridInserter
     //!@{
     //! Type aliases
     using RealCollection
-        = Collection<real_type, Ownership::value, MemSpace::host>;
+        = Collection<table_real_type, Ownership::value, MemSpace::host>;
     using XsGridCollection
         = Collection<XsGridData, Ownership::value, MemSpace::host>;
     using SpanConstReal    = Span<const real_type>;
@@ -47,6 +62,13 @@ class ValueGridInserter
     using GenericIndex     = ItemId<GenericGridData>;
     //!@}
 
+    //! Maximum relative deviation of single- from double-precision lookups
+    struct LookupDeviation
+    {
+        real_type value{0};   //!< Interpolated value (xs, dE/dx, range)
+        real_type inverse{0}; //!< Energy interpolated from a range
+    };
+
   public:
     // Construct with a reference to mutable host data
     ValueGridInserter(RealCollection* real_data, XsGridCollection* xs_grid);
@@ -62,10 +84,51 @@ class ValueGridInserter
     // Add a grid of generic data
     GenericIndex operator()(InterpolatedGrid grid, InterpolatedGrid values);
 
+    // Number of bytes that were not stored because of duplicate grids
+    inline std::size_t bytes_saved() const;
+
+    // Maximum relative deviation of lookups in the stored grids
+    inline const LookupDeviation& max_deviation() const;
+
   private:
-    CollectionBuilder<real_type, MemSpace::host, ItemId<real_type>>   values_;
-    CollectionBuilder<XsGridData, MemSpace::host, ItemId<XsGridData>> xs_grids_;
+    using RealId = ItemId<table_real_type>;
+
+    //! Grids indexed by a hash of their values, and insertion statistics
+    struct GridLookup
+    {
+        std::unordered_multimap<std::size_t, XsIndex> grids;
+        std::size_t                                   bytes_saved{0};
+        LookupDeviation                               max_deviation;
+    };
+
+    const RealCollection*                                      real_data_;
+    const XsGridCollection*                                    xs_grid_data_;
+    CollectionBuilder<table_real_type, MemSpace::host, RealId> values_;
+    CollectionBuilder<XsGridData, MemSpace::host, XsIndex>     xs_grids_;
+    std::shared_ptr<GridLookup>                                lookup_;
 };
 
+//---------------------------------------------------------------------------//
+// INLINE DEFINITIONS
+//---------------------------------------------------------------------------//
+/*!
+ * Number of bytes that were not stored because of duplicate grids.
+ */
+std::size_t ValueGridInserter::bytes_saved() const
+{
+    return lookup_->bytes_saved;
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * Maximum relative deviation of lookups in the stored grids.
+ *
+ * This is nonzero only if the tables are stored in single precision.
+ */
+auto ValueGridInserter::max_deviation() const -> const LookupDeviation&
+{
+    return lookup_->max_deviation;
+}
+
 //---------------------------------------------------------------------------//
 } // namespace celeritas
@@ -8,6 +8,7 @@
 #pragma once
 
 #include "base/Quantity.hh"
+#include "EnergyLookupCache.hh"
 #include "XsGridData.hh"
 
 namespace celeritas
@@ -36,8 +37,9 @@ class XsCalculator
     //!@{
     //! Type aliases
     using Energy = Quantity<XsGridData::EnergyUnits>;
-    using Values
-        = Collection<real_type, Ownership::const_reference, MemSpace::native>;
+    using Values = Collection<table_real_type,
+                              Ownership::const_reference,
+                              MemSpace::native>;
     //!@}
 
   public:
@@ -48,6 +50,9 @@ class XsCalculator
     // Find and interpolate from the energy
     inline CELER_FUNCTION real_type operator()(Energy energy) const;
 
+    // Find and interpolate from a cached energy lookup
+    inline CELER_FUNCTION real_type operator()(EnergyLookupCache& lookup) const;
+
     // Get the cross section at the given index
     inline CELER_FUNCTION real_type operator[](size_type index) const;
 
@@ -26,14 +26,23 @@ XsCalculator::XsCalculator(const XsGridData& grid, const Values& values)
 //---------------------------------------------------------------------------//
 /*!
  * Calculate the cross section.
- *
- * If needed, we can add a "log(energy/MeV)" accessor if we constantly reuse
- * that value and don't want to repeat the `std::log` operation.
  */
 CELER_FUNCTION real_type XsCalculator::operator()(Energy energy) const
+{
+    EnergyLookupCache lookup(energy);
+    return (*this)(lookup);
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * Calculate the cross section, reusing the log energy and grid location.
+ */
+CELER_FUNCTION real_type
+XsCalculator::operator()(EnergyLookupCache& lookup) const
 {
     const UniformGrid loge_grid(data_.log_energy);
-    const real_type   loge = std::log(energy.value());
+    const real_type   loge   = lookup.log_energy();
+    const real_type   energy = lookup.energy().value();
 
     // Snap out-of-bounds values to closest grid points
     size_type lower_idx;
@@ -51,28 +60,28 @@ CELER_FUNCTION real_type XsCalculator::operator()(Energy energy) const
     else
     {
         // Locate the energy bin
-        lower_idx = loge_grid.find(loge);
+        const auto& loc = lookup.find(data_.log_energy);
+        lower_idx       = loc.index;
         CELER_ASSERT(lower_idx + 1 < loge_grid.size());
 
-        const real_type upper_energy = std::exp(loge_grid[lower_idx + 1]);
-        real_type       upper_xs     = this->get(lower_idx + 1);
+        real_type upper_xs = this->get(lower_idx + 1);
         if (lower_idx + 1 == data_.prime_index)
         {
             // Cross section data for the upper point has *already* been scaled
             // by E -- undo the scaling.
-            upper_xs /= upper_energy;
+            upper_xs /= loc.upper_energy;
         }
 
         // Interpolate *linearly* on energy using the lower_idx data.
         LinearInterpolator<real_type> interpolate_xs(
-            {std::exp(loge_grid[lower_idx]), this->get(lower_idx)},
-            {upper_energy, upper_xs});
-        result = interpolate_xs(energy.value());
+            {loc.lower_energy, this->get(lower_idx)},
+            {loc.upper_energy, upper_xs});
+        result = interpolate_xs(energy);
     }
 
     if (lower_idx >= data_.prime_index)
     {
-        result /= energy.value();
+        result /= energy;
     }
     return result;
 }
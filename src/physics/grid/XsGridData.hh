@@ -7,6 +7,7 @@
 //---------------------------------------------------------------------------//
 #pragma once
 
+#include "celeritas_config.h"
 #include "base/Collection.hh"
 #include "base/Types.hh"
 #include "physics/base/Types.hh"
@@ -15,6 +16,20 @@
 
 namespace celeritas
 {
+//---------------------------------------------------------------------------//
+/*!
+ * Storage type for the values of tabulated physics grids.
+ *
+ * With the \c CELERITAS_SINGLE_PRECISION_TABLES build option, the values are
+ * stored in single precision to halve the memory footprint and bandwidth of
+ * the tables. The calculators still interpolate in \c real_type.
+ */
+#if CELERITAS_SINGLE_PRECISION_TABLES
+using table_real_type = float;
+#else
+using table_real_type = real_type;
+#endif
+
 //---------------------------------------------------------------------------//
 /*!
  * Parameterization of a discrete scalar field on a given 1D grid.
@@ -36,9 +51,9 @@ struct XsGridData
         return size_type(-1);
     }
 
-    UniformGridData      log_energy;
-    size_type            prime_index{no_scaling()};
-    ItemRange<real_type> value;
+    UniformGridData            log_energy;
+    size_type                  prime_index{no_scaling()};
+    ItemRange<table_real_type> value;
 
     //! Whether the interface is initialized and valid
     explicit CELER_FUNCTION operator bool() const
@@ -0,0 +1,111 @@
+//----------------------------------*-C++-*----------------------------------//
+// Copyright 2021 UT-Battelle, LLC, and other Celeritas developers.
+// See the top-level COPYRIGHT file for details.
+// SPDX-License-Identifier: (Apache-2.0 OR MIT)
+//---------------------------------------------------------------------------//
+//! \file ElementCdfBuilder.cc
+//---------------------------------------------------------------------------//
+#include "ElementCdfBuilder.hh"
+
+#include <algorithm>
+#include <cmath>
+#include <vector>
+#include "base/Assert.hh"
+#include "base/CollectionBuilder.hh"
+#include "base/Range.hh"
+#include "physics/grid/UniformGrid.hh"
+#include "MaterialParams.hh"
+
+namespace celeritas
+{
+//---------------------------------------------------------------------------//
+/*!
+ * Construct with materials and energy grid bounds.
+ */
+ElementCdfBuilder::ElementCdfBuilder(const MaterialParams& materials,
+                                     Energy                lower,
+                                     Energy                upper,
+                                     size_type             bins_per_decade)
+    : materials_(materials)
+{
+    CELER_EXPECT(lower > zero_quantity());
+    CELER_EXPECT(lower < upper);
+    CELER_EXPECT(bins_per_decade > 0);
+
+    const real_type log_lower = std::log(lower.value());
+    const real_type log_upper = std::log(upper.value());
+    const auto      num_bins  = static_cast<size_type>(std::ceil(
+        bins_per_decade * std::log10(upper.value() / lower.value())));
+    log_energy_ = UniformGridData::from_bounds(
+        log_lower, log_upper, std::max<size_type>(num_bins, 1) + 1);
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * Build tables for all materials from a microscopic cross section.
+ */
+auto ElementCdfBuilder::operator()(const MicroXsFunc& calc_micro_xs) const
+    -> HostData
+{
+    CELER_EXPECT(calc_micro_xs);
+
+    HostData result;
+    auto     reals  = make_builder(&result.reals);
+    auto     tables = make_builder(&result.materials);
+    tables.reserve(materials_.num_materials());
+
+    const UniformGrid      loge_grid(log_energy_);
+    std::vector<real_type> cdf;
+    for (auto mat_id : range(MaterialId{materials_.num_materials()}))
+    {
+        const auto elements = materials_.get(mat_id).elements();
+
+        ElementCdfTable table;
+        if (elements.size() > 1)
+        {
+            cdf.clear();
+            cdf.reserve(loge_grid.size() * elements.size());
+            for (auto i : range(loge_grid.size()))
+            {
+                const Energy    energy{std::exp(loge_grid[i])};
+                const size_type start = cdf.size();
+
+                real_type total = 0;
+                for (const MatElementComponent& el : elements)
+                {
+                    real_type micro_xs = calc_micro_xs(el.element, energy);
+                    CELER_ASSERT(micro_xs >= 0);
+                    total += el.fraction * micro_xs;
+                    cdf.push_back(total);
+                }
+                if (!(total > 0))
+                {
+                    // No interactions at this energy: use number fractions
+                    cdf.resize(start);
+                    for (const MatElementComponent& el : elements)
+                    {
+                        total += el.fraction;
+                        cdf.push_back(total);
+                    }
+                }
+                CELER_ASSERT(total > 0);
+
+                // Normalize
+                for (auto iter = cdf.begin() + start; iter != cdf.end(); ++iter)
+                {
+                    *iter /= total;
+                }
+                cdf.back() = 1;
+            }
+            table.log_energy = log_energy_;
+            table.cdf        = reals.insert_back(cdf.begin(), cdf.end());
+        }
+        tables.push_back(table);
+    }
+
+    CELER_ENSURE(result.materials.size() == materials_.num_materials());
+    return result;
+}
+
+//---------------------------------------------------------------------------//
+} // namespace celeritas
@@ -0,0 +1,64 @@
+//----------------------------------*-C++-*----------------------------------//
+// Copyright 2021 UT-Battelle, LLC, and other Celeritas developers.
+// See the top-level COPYRIGHT file for details.
+// SPDX-License-Identifier: (Apache-2.0 OR MIT)
+//---------------------------------------------------------------------------//
+//! \file ElementCdfBuilder.hh
+//---------------------------------------------------------------------------//
+#pragma once
+
+#include <functional>
+#include "base/Types.hh"
+#include "physics/base/Units.hh"
+#include "physics/grid/UniformGridData.hh"
+#include "ElementCdfData.hh"
+#include "Types.hh"
+
+namespace celeritas
+{
+class MaterialParams;
+
+//---------------------------------------------------------------------------//
+/*!
+ * Tabulate element selection probabilities for every material.
+ *
+ * The cumulative distribution of the number fraction times the microscopic
+ * cross section is calculated on a grid uniform in log energy, which is
+ * shared by all materials. If every element has a zero cross section at a
+ * grid point (e.g. below a threshold), the number fractions are used.
+ *
+ * This builder is presumed to have a short lifespan and should not be
+ * retained after the setup phase.
+ *
+ * \code
+    ElementCdfBuilder build_cdf(materials, lower, upper);
+    data.element_cdf = build_cdf([](ElementId el, Energy e) { ... });
+   \endcode
+ */
+class ElementCdfBuilder
+{
+  public:
+    //!@{
+    //! Type aliases
+    using Energy      = units::MevEnergy;
+    using MicroXsFunc = std::function<real_type(ElementId, Energy)>;
+    using HostData    = ElementCdfData<Ownership::value, MemSpace::host>;
+    //!@}
+
+  public:
+    // Construct with materials and energy grid bounds
+    ElementCdfBuilder(const MaterialParams& materials,
+                      Energy                lower,
+                      Energy                upper,
+                      size_type             bins_per_decade = 7);
+
+    // Build tables for all materials from a microscopic cross section
+    HostData operator()(const MicroXsFunc& calc_micro_xs) const;
+
+  private:
+    const MaterialParams& materials_;
+    UniformGridData       log_energy_;
+};
+
+//---------------------------------------------------------------------------//
+} // namespace celeritas
@@ -0,0 +1,74 @@
+//----------------------------------*-C++-*----------------------------------//
+// Copyright 2021 UT-Battelle, LLC, and other Celeritas developers.
+// See the top-level COPYRIGHT file for details.
+// SPDX-License-Identifier: (Apache-2.0 OR MIT)
+//---------------------------------------------------------------------------//
+//! \file ElementCdfData.hh
+//---------------------------------------------------------------------------//
+#pragma once
+
+#include "base/Collection.hh"
+#include "base/Macros.hh"
+#include "base/Types.hh"
+#include "physics/grid/UniformGridData.hh"
+#include "Types.hh"
+
+namespace celeritas
+{
+//---------------------------------------------------------------------------//
+/*!
+ * Tabulated element selection probabilities for a single material.
+ *
+ * The cumulative distribution is a 2D array indexed as [energy][component]
+ * whose last entry at each energy is unity. Materials with a single element
+ * have an empty table.
+ */
+struct ElementCdfTable
+{
+    UniformGridData      log_energy; //!< Log energy grid [log MeV]
+    ItemRange<real_type> cdf;        //!< Cumulative probabilities
+
+    //! Whether the table is nontrivial
+    explicit CELER_FUNCTION operator bool() const { return !cdf.empty(); }
+};
+
+//---------------------------------------------------------------------------//
+/*!
+ * Energy-gridded element selection tables for a model.
+ *
+ * This is an optional component of model data: when it's assigned, the
+ * element is sampled from the tabulated cumulative distribution instead of
+ * calculating the microscopic cross section of every element in the material
+ * at each interaction.
+ */
+template<Ownership W, MemSpace M>
+struct ElementCdfData
+{
+    template<class T>
+    using Items = Collection<T, W, M>;
+    template<class T>
+    using MaterialItems = Collection<T, W, M, MaterialId>;
+
+    Items<real_type>               reals;
+    MaterialItems<ElementCdfTable> materials;
+
+    //// MEMBER FUNCTIONS ////
+
+    //! Whether the data is assigned
+    explicit CELER_FUNCTION operator bool() const
+    {
+        return !materials.empty();
+    }
+
+    //! Assign from another set of data (which may be empty)
+    template<Ownership W2, MemSpace M2>
+    ElementCdfData& operator=(const ElementCdfData<W2, M2>& other)
+    {
+        reals     = other.reals;
+        materials = other.materials;
+        return *this;
+    }
+};
+
+//---------------------------------------------------------------------------//
+} // namespace celeritas
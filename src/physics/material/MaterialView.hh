@@ -46,6 +46,9 @@ class MaterialView
 
     //// MATERIAL DATA ////
 
+    // ID of this material
+    CELER_FORCEINLINE_FUNCTION MaterialId material_id() const;
+
     // Number density [1/cm^3]
     CELER_FORCEINLINE_FUNCTION real_type number_density() const;
 
@@ -19,6 +19,15 @@ MaterialView::MaterialView(const MaterialParamsRef& params, MaterialId id)
     CELER_EXPECT(id < params.materials.size());
 }
 
+//---------------------------------------------------------------------------//
+/*!
+ * Get the ID of this material.
+ */
+CELER_FUNCTION MaterialId MaterialView::material_id() const
+{
+    return material_;
+}
+
 //---------------------------------------------------------------------------//
 /*!
  * Get atomic number density [1/cm^3].
@@ -0,0 +1,64 @@
+//----------------------------------*-C++-*----------------------------------//
+// Copyright 2021 UT-Battelle, LLC, and other Celeritas developers.
+// See the top-level COPYRIGHT file for details.
+// SPDX-License-Identifier: (Apache-2.0 OR MIT)
+//---------------------------------------------------------------------------//
+//! \file TabulatedElementSelector.hh
+//---------------------------------------------------------------------------//
+#pragma once
+
+#include "base/Macros.hh"
+#include "base/Span.hh"
+#include "base/Types.hh"
+#include "physics/base/Units.hh"
+#include "ElementCdfData.hh"
+#include "Types.hh"
+
+namespace celeritas
+{
+//---------------------------------------------------------------------------//
+/*!
+ * Select an element using precalculated cumulative probabilities.
+ *
+ * This samples the same distribution as \c ElementSelector, but rather than
+ * evaluating the microscopic cross section of every element in the material,
+ * the cumulative distribution is linearly interpolated in log energy from a
+ * table built by \c ElementCdfBuilder. Energies outside the tabulated range
+ * use the probabilities at the nearest endpoint.
+ *
+ * \code
+    TabulatedElementSelector select_el(model.element_cdf, mat_id, energy);
+    ElementComponentId id = select_el(rng);
+   \endcode
+ */
+class TabulatedElementSelector
+{
+  public:
+    //!@{
+    //! Type aliases
+    using Energy = units::MevEnergy;
+    using ElementCdfRef
+        = ElementCdfData<Ownership::const_reference, MemSpace::native>;
+    //!@}
+
+  public:
+    // Construct with tabulated data, material, and incident energy
+    inline CELER_FUNCTION TabulatedElementSelector(const ElementCdfRef& data,
+                                                   MaterialId material,
+                                                   Energy     energy);
+
+    // Sample with the given RNG
+    template<class Engine>
+    inline CELER_FUNCTION ElementComponentId operator()(Engine& rng) const;
+
+  private:
+    Span<const real_type> cdf_;
+    size_type             num_elements_{0};
+    size_type             index_{0};
+    real_type             frac_{0};
+};
+
+//---------------------------------------------------------------------------//
+} // namespace celeritas
+
+#include "TabulatedElementSelector.i.hh"
@@ -0,0 +1,88 @@
+//----------------------------------*-C++-*----------------------------------//
+// Copyright 2021 UT-Battelle, LLC, and other Celeritas developers.
+// See the top-level COPYRIGHT file for details.
+// SPDX-License-Identifier: (Apache-2.0 OR MIT)
+//---------------------------------------------------------------------------//
+//! \file TabulatedElementSelector.i.hh
+//---------------------------------------------------------------------------//
+#include <cmath>
+
+#include "base/Assert.hh"
+#include "physics/grid/UniformGrid.hh"
+#include "random/distributions/GenerateCanonical.hh"
+
+namespace celeritas
+{
+//---------------------------------------------------------------------------//
+/*!
+ * Construct with tabulated data, material, and incident energy.
+ */
+CELER_FUNCTION
+TabulatedElementSelector::TabulatedElementSelector(const ElementCdfRef& data,
+                                                   MaterialId material,
+                                                   Energy     energy)
+{
+    CELER_EXPECT(data);
+    CELER_EXPECT(material < data.materials.size());
+    CELER_EXPECT(energy > zero_quantity());
+
+    const ElementCdfTable& table = data.materials[material];
+    if (!table)
+    {
+        // Single-element material
+        return;
+    }
+
+    cdf_ = data.reals[table.cdf];
+    const UniformGrid loge_grid(table.log_energy);
+    num_elements_ = cdf_.size() / loge_grid.size();
+    CELER_ASSERT(num_elements_ * loge_grid.size() == cdf_.size());
+
+    // Locate the energy on the grid, clamping to the endpoints
+    const real_type loge = std::log(energy.value());
+    if (loge <= loge_grid.front())
+    {
+        index_ = 0;
+        frac_  = 0;
+    }
+    else if (loge >= loge_grid.back())
+    {
+        index_ = loge_grid.size() - 2;
+        frac_  = 1;
+    }
+    else
+    {
+        index_ = loge_grid.find(loge);
+        frac_  = (loge - loge_grid[index_]) / loge_grid.data().delta;
+    }
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * Sample the element with the given RNG.
+ *
+ * The last component is selected without reading its (unit) cumulative
+ * probability, so roundoff in the table can't cause an invalid result.
+ */
+template<class Engine>
+CELER_FUNCTION ElementComponentId
+TabulatedElementSelector::operator()(Engine& rng) const
+{
+    if (num_elements_ < 2)
+        return ElementComponentId{0};
+
+    const real_type  u     = generate_canonical(rng);
+    const real_type* lower = cdf_.data() + index_ * num_elements_;
+    const real_type* upper = lower + num_elements_;
+    size_type        i     = 0;
+    size_type        imax  = num_elements_ - 1;
+    for (; i != imax; ++i)
+    {
+        if (u < (1 - frac_) * lower[i] + frac_ * upper[i])
+            break;
+    }
+    return ElementComponentId{i};
+}
+
+//---------------------------------------------------------------------------//
+} // namespace celeritas
@@ -10,11 +10,14 @@
 #include <random>
 #include "base/Assert.hh"
 #include "base/CollectionBuilder.hh"
+#include "base/Range.hh"
 #include "comm/Device.hh"
 #include "random/detail/RngStateInit.hh"
 
 #include "celeritas_config.h"
-#if CELERITAS_USE_CUDA
+#if CELERITAS_RNG == CELERITAS_RNG_PHILOX
+#    include "detail/Philox.hh"
+#elif CELERITAS_USE_CUDA
 /*!
  * \def QUALIFIERS
  *
@@ -29,13 +32,46 @@
 #include "base/Collection.hh"
 #include "base/Types.hh"
 
-#if !CELERITAS_USE_CUDA
+#if CELERITAS_RNG == CELERITAS_RNG_XORWOW && !CELERITAS_USE_CUDA
 //! Define an unused RNG state for "device" code to support no-cuda build
 using curandState_t = celeritas::detail::MockCurandState;
 #endif
 
 namespace celeritas
 {
+#if CELERITAS_RNG == CELERITAS_RNG_PHILOX
+//---------------------------------------------------------------------------//
+/*!
+ * Properties of the global counter-based random number generator.
+ *
+ * The key derived from the seed is shared by every stream, so it is stored
+ * here rather than in the state of each track slot.
+ */
+template<Ownership W, MemSpace M>
+struct RngParamsData
+{
+    //// DATA ////
+
+    unsigned int seed = 12345; // TODO: replace with std::seed_seq etc
+
+    //// METHODS ////
+
+    //! Key shared by all streams
+    CELER_FUNCTION detail::PhiloxKey key() const
+    {
+        return detail::philox_key(seed);
+    }
+
+    //! Assign from another set of data
+    template<Ownership W2, MemSpace M2>
+    RngParamsData& operator=(const RngParamsData<W2, M2>& other)
+    {
+        seed = other.seed;
+        return *this;
+    }
+};
+
+#else
 //---------------------------------------------------------------------------//
 /*!
  * Properties of the global random number generator.
@@ -76,7 +112,30 @@ struct RngParamsData<W, MemSpace::host>
         return *this;
     }
 };
+#endif
+
+#if CELERITAS_RNG == CELERITAS_RNG_PHILOX
+//---------------------------------------------------------------------------//
+/*!
+ * Counter-based RNG state, which is the same on host and device.
+ */
+template<MemSpace M>
+struct RngThreadState
+{
+    detail::PhiloxState state;
+};
+
+//---------------------------------------------------------------------------//
+/*!
+ * Initialize an RNG with a stream ID.
+ */
+template<MemSpace M>
+struct RngInitializer
+{
+    ull_int stream{};
+};
 
+#else
 //---------------------------------------------------------------------------//
 /*!
  * The underlying RNG state is *different* on host and device.
@@ -114,6 +173,7 @@ struct RngInitializer<MemSpace::host>
 {
     ull_int seed;
 };
+#endif
 
 //---------------------------------------------------------------------------//
 /*!
@@ -156,16 +216,35 @@ struct RngStateData
 //---------------------------------------------------------------------------//
 /*!
  * Resize and initialize with the seed stored in params.
+ *
+ * The counter-based states are initialized on host and copied: each slot
+ * starts a distinct stream whose ID has all bits set in the upper (event)
+ * word, so it can't coincide with the stream of a track. The key derived from
+ * the seed is not part of the state. With cuRAND, each slot is seeded from a
+ * host RNG and the states are initialized by a kernel.
  */
 template<MemSpace M>
 inline void
-resize(RngStateData<Ownership::value, M>*                               state,
-       const RngParamsData<Ownership::const_reference, MemSpace::host>& params,
-       size_type                                                        size)
+resize(RngStateData<Ownership::value, M>* state,
+       CELER_MAYBE_UNUSED const
+           RngParamsData<Ownership::const_reference, MemSpace::host>& params,
+       size_type size)
 {
     CELER_EXPECT(size > 0);
     CELER_EXPECT(M == MemSpace::host || celeritas::device());
 
+#if CELERITAS_RNG == CELERITAS_RNG_PHILOX
+    using RngState = RngThreadState<M>;
+
+    StateCollection<RngState, Ownership::value, MemSpace::host> host_states;
+    make_builder(&host_states).resize(size);
+    for (auto tid : range(ThreadId{size}))
+    {
+        ull_int stream = (~ull_int(0) << 32) | tid.get();
+        detail::philox_select_stream(stream, &host_states[tid].state);
+    }
+    state->rng = host_states;
+#else
     using RngInit = RngInitializer<M>;
 
     // Host-side RNG for creating seeds
@@ -184,7 +263,11 @@ resize(RngStateData<Ownership::value, M>*                               state,
     make_builder(&state->rng).resize(size);
     detail::RngInitData<Ownership::value, M> init_data;
     init_data.seeds = host_seeds;
-    detail::rng_state_init(make_ref(*state), make_const_ref(init_data));
+    RngParamsData<Ownership::const_reference, M> native_params;
+    native_params = params;
+    detail::rng_state_init(
+        native_params, make_ref(*state), make_const_ref(init_data));
+#endif
 }
 
 } // namespace celeritas
@@ -7,6 +7,7 @@
 //---------------------------------------------------------------------------//
 #pragma once
 
+#include "celeritas_config.h"
 #include "base/OpaqueId.hh"
 #include "random/distributions/GenerateCanonical.hh"
 #include "RngData.hh"
@@ -20,6 +21,14 @@ namespace celeritas
  * The RngEngine uses a C++11-like interface to generate random data. The
  * sampling of uniform floating point data is done with specializations to the
  * GenerateCanonical class.
+ *
+ * The underlying generator is chosen at configure time with \c CELERITAS_RNG.
+ * The default uses cuRAND's XORWOW generator, whose state is a sequence
+ * position unique to each track slot. The counter-based Philox4x32-10
+ * generator instead computes each random number from a key (derived from the
+ * seed and stored in the params) and a counter (the stream ID and number of
+ * draws). Its 16-byte state can select an independent stream for each track,
+ * so the results do not depend on the slot or thread a track is assigned to.
  */
 class RngEngine
 {
@@ -28,21 +37,33 @@ class RngEngine
     //! Type aliases
     using result_type   = unsigned int;
     using Initializer_t = RngInitializer<MemSpace::native>;
-    using StateRef      = RngStateData<Ownership::reference, MemSpace::native>;
+    using ParamsRef
+        = RngParamsData<Ownership::const_reference, MemSpace::native>;
+    using StateRef = RngStateData<Ownership::reference, MemSpace::native>;
     //!@}
 
   public:
-    // Construct from state
-    inline CELER_FUNCTION RngEngine(const StateRef& state, const ThreadId& id);
+    // Construct from params and state
+    inline CELER_FUNCTION RngEngine(const ParamsRef& params,
+                                    const StateRef&  state,
+                                    const ThreadId&  id);
 
-    // Initialize state from seed
+    // Initialize state
     inline CELER_FUNCTION RngEngine& operator=(const Initializer_t& s);
 
     // Sample a random number
     inline CELER_FUNCTION result_type operator()();
 
+#if CELERITAS_RNG == CELERITAS_RNG_PHILOX
+    // Start a new stream, keeping the seed
+    inline CELER_FUNCTION void select_stream(ull_int stream);
+#endif
+
   private:
-    curandState_t* state_;
+    RngThreadState<MemSpace::native>* state_;
+#if CELERITAS_RNG == CELERITAS_RNG_PHILOX
+    detail::PhiloxKey key_;
+#endif
 
     template<class Generator, class RealType>
     friend class GenerateCanonical;
@@ -12,22 +12,87 @@ namespace celeritas
 {
 //---------------------------------------------------------------------------//
 /*!
- * Construct from state.
+ * Construct from params and state.
  */
 CELER_FUNCTION
-RngEngine::RngEngine(const StateRef& state, const ThreadId& id)
+RngEngine::RngEngine(CELER_MAYBE_UNUSED const ParamsRef& params,
+                     const StateRef&                      state,
+                     const ThreadId&                      id)
 {
     CELER_EXPECT(id < state.rng.size());
-    state_ = &state.rng[id].state;
+    state_ = &state.rng[id];
+#if CELERITAS_RNG == CELERITAS_RNG_PHILOX
+    key_ = params.key();
+#endif
 }
 
+#if CELERITAS_RNG == CELERITAS_RNG_PHILOX
+//---------------------------------------------------------------------------//
+/*!
+ * Initialize the RNG engine at the start of a stream.
+ */
+CELER_FUNCTION RngEngine& RngEngine::operator=(const Initializer_t& s)
+{
+    detail::philox_select_stream(s.stream, &state_->state);
+    return *this;
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * Sample a random number.
+ *
+ * Each sample regenerates the block containing the next word of the stream.
+ */
+CELER_FUNCTION auto RngEngine::operator()() -> result_type
+{
+    return detail::philox_next_word(key_, &state_->state);
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * Start a new stream, keeping the seed.
+ */
+CELER_FUNCTION void RngEngine::select_stream(ull_int stream)
+{
+    detail::philox_select_stream(stream, &state_->state);
+}
+
+//---------------------------------------------------------------------------//
+// Specializations for GenerateCanonical
+//---------------------------------------------------------------------------//
+/*!
+ * Specialization for RngEngine (float).
+ *
+ * The upper 24 bits of a random integer are scaled to [0, 1).
+ */
+CELER_FUNCTION float
+GenerateCanonical<RngEngine, float>::operator()(RngEngine& rng)
+{
+    return static_cast<float>(rng() >> 8) * (1.0f / 16777216.0f);
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * Specialization for RngEngine (double).
+ *
+ * Two consecutive words are combined into 53 random bits.
+ */
+CELER_FUNCTION double
+GenerateCanonical<RngEngine, double>::operator()(RngEngine& rng)
+{
+    ull_int upper = rng();
+    ull_int bits  = (upper << 21) ^ (rng() >> 11);
+    return static_cast<double>(bits) * (1.0 / 9007199254740992.0);
+}
+
+#else
 //---------------------------------------------------------------------------//
 /*!
  * Initialize the RNG engine with a seed value.
  */
 CELER_FUNCTION RngEngine& RngEngine::operator=(const Initializer_t& s)
 {
-    curand_init(s.seed, 0, 0, state_);
+    curand_init(s.seed, 0, 0, &state_->state);
     return *this;
 }
 
@@ -37,7 +102,7 @@ CELER_FUNCTION RngEngine& RngEngine::operator=(const Initializer_t& s)
  */
 CELER_FUNCTION auto RngEngine::operator()() -> result_type
 {
-    return curand(state_);
+    return curand(&state_->state);
 }
 
 //---------------------------------------------------------------------------//
@@ -49,7 +114,7 @@ CELER_FUNCTION auto RngEngine::operator()() -> result_type
 CELER_FUNCTION float
 GenerateCanonical<RngEngine, float>::operator()(RngEngine& rng)
 {
-    return curand_uniform(rng.state_);
+    return curand_uniform(&rng.state_->state);
 }
 
 //---------------------------------------------------------------------------//
@@ -59,8 +124,9 @@ GenerateCanonical<RngEngine, float>::operator()(RngEngine& rng)
 CELER_FUNCTION double
 GenerateCanonical<RngEngine, double>::operator()(RngEngine& rng)
 {
-    return curand_uniform_double(rng.state_);
+    return curand_uniform_double(&rng.state_->state);
 }
+#endif
 
 //---------------------------------------------------------------------------//
 } // namespace celeritas
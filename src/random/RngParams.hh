@@ -52,6 +52,7 @@ class RngParams
 RngParams::RngParams(unsigned int seed)
 {
     host_ref_.seed = seed;
+    device_ref_    = host_ref_;
 }
 
 } // namespace celeritas
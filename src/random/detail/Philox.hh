@@ -0,0 +1,127 @@
+//----------------------------------*-C++-*----------------------------------//
+// Copyright 2021 UT-Battelle, LLC, and other Celeritas developers.
+// See the top-level COPYRIGHT file for details.
+// SPDX-License-Identifier: (Apache-2.0 OR MIT)
+//---------------------------------------------------------------------------//
+//! \file Philox.hh
+//---------------------------------------------------------------------------//
+#pragma once
+
+#include "base/Array.hh"
+#include "base/Macros.hh"
+#include "base/Types.hh"
+
+namespace celeritas
+{
+namespace detail
+{
+//---------------------------------------------------------------------------//
+//!@{
+//! Philox 4x32 counter and key types
+using PhiloxCounter = Array<unsigned int, 4>;
+using PhiloxKey     = Array<unsigned int, 2>;
+//!@}
+
+static_assert(sizeof(unsigned int) == 4, "Philox requires 32-bit integers");
+
+//---------------------------------------------------------------------------//
+/*!
+ * State of a counter-based random number stream.
+ *
+ * The counter holds the stream ID in its upper two words and the number of
+ * words drawn from the stream in its lower two. The key, which is derived from
+ * the seed, is shared by all streams and is stored with the RNG parameters.
+ */
+struct PhiloxState
+{
+    PhiloxCounter counter;
+};
+
+//---------------------------------------------------------------------------//
+/*!
+ * Generate a block of four random integers with the Philox4x32-10 function.
+ *
+ * This is the counter-based generator of Salmon et al., "Parallel random
+ * numbers: as easy as 1, 2, 3" (SC11): the output is a bijection of the
+ * counter for each key, so independent streams need no shared state. The
+ * results match the known-answer tests of the Random123 library.
+ */
+inline CELER_FUNCTION PhiloxCounter philox4x32(PhiloxCounter ctr,
+                                               PhiloxKey     key)
+{
+    constexpr unsigned int mult[]     = {0xD2511F53u, 0xCD9E8D57u};
+    constexpr unsigned int weyl[]     = {0x9E3779B9u, 0xBB67AE85u};
+    constexpr int          num_rounds = 10;
+
+    for (int i = 0; i < num_rounds; ++i)
+    {
+        if (i > 0)
+        {
+            // Bump the key
+            key[0] += weyl[0];
+            key[1] += weyl[1];
+        }
+
+        ull_int prod0 = static_cast<ull_int>(mult[0]) * ctr[0];
+        ull_int prod1 = static_cast<ull_int>(mult[1]) * ctr[2];
+
+        ctr = {static_cast<unsigned int>(prod1 >> 32) ^ ctr[1] ^ key[0],
+               static_cast<unsigned int>(prod1),
+               static_cast<unsigned int>(prod0 >> 32) ^ ctr[3] ^ key[1],
+               static_cast<unsigned int>(prod0)};
+    }
+    return ctr;
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * Construct the key from a seed.
+ */
+inline CELER_FUNCTION PhiloxKey philox_key(ull_int seed)
+{
+    return {static_cast<unsigned int>(seed),
+            static_cast<unsigned int>(seed >> 32)};
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * Start the stream with the given ID.
+ */
+inline CELER_FUNCTION void philox_select_stream(ull_int stream, PhiloxState* s)
+{
+    s->counter = {0u,
+                  0u,
+                  static_cast<unsigned int>(stream),
+                  static_cast<unsigned int>(stream >> 32)};
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * Draw the next random word from a stream.
+ *
+ * Word \em i of a stream is word \em i mod 4 of the block generated from the
+ * counter \em i / 4, so consecutive draws use all four words of each block.
+ * Instead of buffering the block in the state, it is regenerated for each
+ * word.
+ */
+inline CELER_FUNCTION unsigned int
+philox_next_word(PhiloxKey key, PhiloxState* s)
+{
+    PhiloxCounter& count = s->counter;
+
+    PhiloxCounter block = count;
+    block[0]            = (count[0] >> 2) | (count[1] << 30);
+    block[1]            = count[1] >> 2;
+    unsigned int word   = count[0] & 3u;
+
+    // Increment the 64-bit word count
+    if (++count[0] == 0)
+    {
+        ++count[1];
+    }
+    return philox4x32(block, key)[word];
+}
+
+//---------------------------------------------------------------------------//
+} // namespace detail
+} // namespace celeritas
@@ -20,12 +20,13 @@ namespace detail
  * Initialize the RNG states from seeds randomly generated on host.
  */
 void rng_state_init(
-    const RngStateData<Ownership::reference, MemSpace::host>&      rng,
-    const RngInitData<Ownership::const_reference, MemSpace::host>& seeds)
+    const RngParamsData<Ownership::const_reference, MemSpace::host>& params,
+    const RngStateData<Ownership::reference, MemSpace::host>&        rng,
+    const RngInitData<Ownership::const_reference, MemSpace::host>&   seeds)
 {
     for (auto tid : range(ThreadId{seeds.size()}))
     {
-        RngEngine engine(rng, tid);
+        RngEngine engine(params, rng, tid);
         engine = seeds.seeds[tid];
     }
 }
@@ -24,13 +24,14 @@ namespace
  * Initialize the RNG states on device from seeds randomly generated on host.
  */
 __global__ void rng_state_init_kernel(
-    RngStateData<Ownership::reference, MemSpace::device> const      state,
-    RngInitData<Ownership::const_reference, MemSpace::device> const init)
+    RngParamsData<Ownership::const_reference, MemSpace::device> const params,
+    RngStateData<Ownership::reference, MemSpace::device> const        state,
+    RngInitData<Ownership::const_reference, MemSpace::device> const   init)
 {
     auto tid = celeritas::KernelParamCalculator::thread_id();
     if (tid.get() < state.size())
     {
-        RngEngine rng(state, tid);
+        RngEngine rng(params, state, tid);
         rng = init.seeds[tid];
     }
 }
@@ -45,16 +46,18 @@ __global__ void rng_state_init_kernel(
  * Initialize the RNG states on device from seeds randomly generated on host.
  */
 void rng_state_init(
-    const RngStateData<Ownership::reference, MemSpace::device>&      rng,
-    const RngInitData<Ownership::const_reference, MemSpace::device>& seeds)
+    const RngParamsData<Ownership::const_reference, MemSpace::device>& params,
+    const RngStateData<Ownership::reference, MemSpace::device>&        rng,
+    const RngInitData<Ownership::const_reference, MemSpace::device>&   seeds)
 {
     CELER_EXPECT(rng.size() == seeds.size());
 
     // Launch kernel to build RNG states on device
     static const celeritas::KernelParamCalculator calc_launch_params(
         rng_state_init_kernel, "rng_state_init");
-    auto params = calc_launch_params(seeds.size());
-    rng_state_init_kernel<<<params.grid_size, params.block_size>>>(rng, seeds);
+    auto lparams = calc_launch_params(seeds.size());
+    rng_state_init_kernel<<<lparams.grid_size, lparams.block_size>>>(
+        params, rng, seeds);
     CELER_CUDA_CHECK_ERROR();
 }
 
@@ -15,6 +15,8 @@ namespace celeritas
 template<MemSpace M>
 struct RngInitializer;
 template<Ownership W, MemSpace M>
+struct RngParamsData;
+template<Ownership W, MemSpace M>
 struct RngStateData;
 
 namespace detail
@@ -49,12 +51,14 @@ struct RngInitData
 //---------------------------------------------------------------------------//
 // Initialize the RNG state on host/device
 void rng_state_init(
-    const RngStateData<Ownership::reference, MemSpace::device>&      rng,
-    const RngInitData<Ownership::const_reference, MemSpace::device>& seeds);
+    const RngParamsData<Ownership::const_reference, MemSpace::device>& params,
+    const RngStateData<Ownership::reference, MemSpace::device>&        rng,
+    const RngInitData<Ownership::const_reference, MemSpace::device>&   seeds);
 
 void rng_state_init(
-    const RngStateData<Ownership::reference, MemSpace::host>&      rng,
-    const RngInitData<Ownership::const_reference, MemSpace::host>& seeds);
+    const RngParamsData<Ownership::const_reference, MemSpace::host>& params,
+    const RngStateData<Ownership::reference, MemSpace::host>&        rng,
+    const RngInitData<Ownership::const_reference, MemSpace::host>&   seeds);
 
 //---------------------------------------------------------------------------//
 } // namespace detail
@@ -18,6 +18,7 @@ namespace detail
  * Initialize the RNG states on device from seeds randomly generated on host.
  */
 void rng_state_init(
+    const RngParamsData<Ownership::const_reference, MemSpace::device>&,
     const RngStateData<Ownership::reference, MemSpace::device>&,
     const RngInitData<Ownership::const_reference, MemSpace::device>&)
 {
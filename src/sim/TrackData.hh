@@ -82,6 +82,11 @@ struct ParamsData
 //---------------------------------------------------------------------------//
 /*!
  * Thread-local state data.
+ *
+ * The per-track kernels only visit the first \c num_active track slots. This
+ * is the full state size unless live tracks are being compacted into the
+ * front of the state vector (see \c compact_tracks ), in which case all slots
+ * at or beyond \c num_active are guaranteed to be empty.
  */
 template<Ownership W, MemSpace M>
 struct StateData
@@ -105,6 +110,9 @@ struct StateData
     Items<real_type>   energy_deposition;
     Items<Interaction> interactions;
 
+    // Number of leading track slots that may be occupied
+    size_type num_active{};
+
     //! Number of state elements
     CELER_FUNCTION size_type size() const { return particles.size(); }
 
@@ -132,6 +140,7 @@ struct StateData
         step_length       = other.step_length;
         energy_deposition = other.energy_deposition;
         interactions      = other.interactions;
+        num_active        = other.num_active;
         return *this;
     }
 };
@@ -170,6 +179,8 @@ resize(StateData<Ownership::value, M>*                               data,
     resize(&data->step_length, size);
     resize(&data->energy_deposition, size);
     resize(&data->interactions, size);
+
+    data->num_active = size;
 }
 
 //---------------------------------------------------------------------------//
@@ -7,6 +7,7 @@
 //---------------------------------------------------------------------------//
 #pragma once
 
+#include <vector>
 #include "base/Algorithms.hh"
 #include "base/CollectionBuilder.hh"
 #include "base/Copier.hh"
@@ -16,6 +17,83 @@
 
 namespace celeritas
 {
+namespace detail
+{
+//---------------------------------------------------------------------------//
+/*!
+ * Make room for new secondaries by moving initializers to or from the host.
+ *
+ * If the new secondaries would exceed the capacity of the initializer storage,
+ * the most recently added initializers are copied to the back of the host
+ * overflow buffer. Otherwise, any free storage is refilled from the back of
+ * the overflow buffer. Since the new secondaries are always appended after
+ * this exchange, the initializers with valid parent track slots are never
+ * moved.
+ */
+template<MemSpace M>
+inline void exchange_overflow(size_type num_secondaries,
+                              TrackInitStateData<Ownership::value, M>* data,
+                              std::vector<TrackInitializer>* overflow)
+{
+    auto& inits = data->initializers;
+    CELER_VALIDATE(num_secondaries <= inits.capacity(),
+                   << "insufficient capacity (" << inits.capacity()
+                   << ") for track initializers (created " << num_secondaries
+                   << " new secondaries)");
+
+    size_type available  = inits.capacity() - num_secondaries;
+    size_type num_stored = inits.size();
+    if (num_stored > available)
+    {
+        // Spill the excess initializers to the host
+        size_type count = num_stored - available;
+        size_type start = overflow->size();
+        overflow->resize(start + count);
+        Copier<TrackInitializer, M> copy{inits.data().subspan(available)};
+        copy(MemSpace::host, make_span(*overflow).subspan(start));
+        inits.resize(available);
+    }
+    else if (!overflow->empty())
+    {
+        // Refill the free storage from the host
+        size_type count = min(available - num_stored,
+                              static_cast<size_type>(overflow->size()));
+        size_type start = overflow->size() - count;
+        inits.resize(num_stored + count);
+        Copier<TrackInitializer, MemSpace::host> copy{
+            make_span(*overflow).subspan(start)};
+        copy(M, inits.data().subspan(num_stored));
+        overflow->resize(start);
+    }
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * Copy host primaries to the templated memory space and append initializers.
+ */
+template<MemSpace M>
+inline void append_primaries(Span<const Primary> host_primaries,
+                             TrackInitStateData<Ownership::value, M>* data)
+{
+    CELER_EXPECT(!host_primaries.empty());
+
+    auto count = host_primaries.size();
+    data->initializers.resize(data->initializers.size() + count);
+
+    // Allocate memory and copy primaries
+    Collection<Primary, Ownership::value, M> primaries;
+    make_builder(&primaries).resize(count);
+    Copier<Primary, MemSpace::host> copy{host_primaries};
+    copy(M, primaries[AllItems<Primary, M>{}]);
+
+    // Create track initializers from primaries
+    detail::process_primaries(primaries[AllItems<Primary, M>{}],
+                              make_ref(*data));
+}
+
+//---------------------------------------------------------------------------//
+} // namespace detail
+
 //---------------------------------------------------------------------------//
 // HELPER FUNCTIONS
 //---------------------------------------------------------------------------//
@@ -39,24 +117,86 @@ inline void extend_from_primaries(const TrackInitParamsHostRef& params,
                      data->num_primaries);
     if (count > 0)
     {
-        data->initializers.resize(data->initializers.size() + count);
-
-        // Allocate memory and copy primaries
-        Collection<Primary, Ownership::value, M> primaries;
-        make_builder(&primaries).resize(count);
-        Copier<Primary, MemSpace::host> copy{
+        detail::append_primaries(
             params.primaries[ItemRange<Primary>(
                 ItemId<Primary>(data->num_primaries - count),
-                ItemId<Primary>(data->num_primaries))]};
-        copy(M, primaries[AllItems<Primary, M>{}]);
+                ItemId<Primary>(data->num_primaries))],
+            data);
         data->num_primaries -= count;
+    }
+}
 
-        // Create track initializers from primaries
-        detail::process_primaries(primaries[AllItems<Primary, M>{}],
-                                  make_ref(*data));
+//---------------------------------------------------------------------------//
+/*!
+ * Create track initializers from a host buffer of primary particles.
+ *
+ * This is used to stream primaries that are read in batches rather than
+ * stored in \c TrackInitParams. As many primaries as will fit in the
+ * available initializer storage are removed from the back of the buffer; the
+ * rest are left for a later call. The track counters for the events in the
+ * batch must have been set with \c extend_track_counters when the batch was
+ * read.
+ */
+template<MemSpace M>
+inline void extend_from_primaries(std::vector<Primary>* primaries,
+                                  TrackInitStateData<Ownership::value, M>* data)
+{
+    CELER_EXPECT(primaries);
+    CELER_EXPECT(data && *data);
+
+    // Number of primaries to initialize
+    auto count = min(data->initializers.capacity() - data->initializers.size(),
+                     static_cast<size_type>(primaries->size()));
+    if (count > 0)
+    {
+        size_type start = primaries->size() - count;
+        detail::append_primaries(make_span(*primaries).subspan(start), data);
+        primaries->resize(start);
     }
 }
 
+//---------------------------------------------------------------------------//
+/*!
+ * Reserve track IDs for the primary particles in a new batch of events.
+ *
+ * The track counter for each event is incremented by the number of primaries
+ * in that event, and the counters are extended if the batch contains events
+ * beyond the current size. Secondaries produced in these events are then
+ * numbered after the primaries. This must be called once for every batch of
+ * primaries that is read after the initial \c TrackInitParams, before any of
+ * its primaries are initialized.
+ */
+template<MemSpace M>
+inline void
+extend_track_counters(Span<const Primary>                      primaries,
+                      TrackInitStateData<Ownership::value, M>* data)
+{
+    using CounterT = TrackId::size_type;
+    CELER_EXPECT(data && *data);
+
+    // Copy the current counters to the host
+    std::vector<CounterT> counters(data->track_counters.size());
+    Copier<CounterT, M> copy{
+        data->track_counters[AllItems<CounterT, M>{}]};
+    copy(MemSpace::host, make_span(counters));
+
+    // Add the primaries in each event
+    for (const Primary& p : primaries)
+    {
+        const auto event_id = p.event_id.get();
+        if (!(event_id < counters.size()))
+        {
+            counters.resize(event_id + 1);
+        }
+        ++counters[event_id];
+    }
+
+    Collection<CounterT, Ownership::value, MemSpace::host, EventId>
+        track_counters;
+    make_builder(&track_counters).insert_back(counters.begin(), counters.end());
+    data->track_counters = track_counters;
+}
+
 //---------------------------------------------------------------------------//
 /*!
  * Initialize track states
@@ -145,19 +285,30 @@ initialize_tracks(const ParamsData<Ownership::const_reference, M>& params,
    vacancies          | 1  4
 
    \endverbatim
+ *
+ * If a host overflow buffer is provided, initializers that do not fit in the
+ * storage are moved to the host rather than raising an error, and they are
+ * moved back as space becomes available in later steps. The total number of
+ * pending initializers is then the sum of the stored and overflow sizes.
+ *
+ * Only the first \c num_active track slots are examined, so if the live
+ * tracks have been compacted, the vacancies do not include the (empty) slots
+ * beyond the active range.
  */
 template<MemSpace M>
 inline void
 extend_from_secondaries(const ParamsData<Ownership::const_reference, M>& params,
                         const StateData<Ownership::reference, M>& states,
-                        TrackInitStateData<Ownership::value, M>*  data)
+                        TrackInitStateData<Ownership::value, M>*  data,
+                        std::vector<TrackInitializer>* overflow = nullptr)
 {
     CELER_EXPECT(params);
     CELER_EXPECT(states);
     CELER_EXPECT(data && *data);
 
-    // Resize the vector of vacancies to be equal to the number of tracks
-    data->vacancies.resize(states.size());
+    // Resize the vector of vacancies to be equal to the number of active
+    // track slots
+    data->vacancies.resize(states.num_active);
 
     // Launch a kernel to identify which track slots are still alive and count
     // the number of surviving secondaries per track
@@ -169,10 +320,14 @@ extend_from_secondaries(const ParamsData<Ownership::const_reference, M>& params,
     data->vacancies.resize(num_vac);
 
     // Sum the total number secondaries produced in all interactions
-    // TODO: if we don't have space for all the secondaries, we will need to
-    // buffer the current track initializers to create room
-    size_type num_secondaries = detail::reduce_counts<M>(
-        data->secondary_counts[AllItems<size_type, M>{}]);
+    auto counts = data->secondary_counts[AllItems<size_type, M>{}].first(
+        states.num_active);
+    size_type num_secondaries = detail::reduce_counts<M>(counts);
+    if (overflow)
+    {
+        // Buffer the current track initializers on host to create room
+        detail::exchange_overflow(num_secondaries, data, overflow);
+    }
     CELER_VALIDATE(num_secondaries + data->initializers.size()
                        <= data->initializers.capacity(),
                    << "insufficient capacity (" << data->initializers.capacity()
@@ -185,8 +340,7 @@ extend_from_secondaries(const ParamsData<Ownership::const_reference, M>& params,
     // for each thread. Starting at that index, each thread creates track
     // initializers from all surviving secondaries produced in its
     // interaction.
-    detail::exclusive_scan_counts<M>(
-        data->secondary_counts[AllItems<size_type, M>{}]);
+    detail::exclusive_scan_counts<M>(counts);
 
     // Launch a kernel to create track initializers from secondaries
     data->parents.resize(num_secondaries);
@@ -194,5 +348,59 @@ extend_from_secondaries(const ParamsData<Ownership::const_reference, M>& params,
     detail::process_secondaries(params, states, make_ref(*data));
 }
 
+//---------------------------------------------------------------------------//
+/*!
+ * Move all live tracks into a dense prefix of the track vector.
+ *
+ * This must be called after \c extend_from_secondaries, when the vacancies
+ * are the sorted indices of the empty slots in the active range. Live tracks
+ * in the tail of the active range are moved into the empty slots before
+ * \f$ n_\mathrm{alive} \f$, and the parents of any secondaries they produced
+ * are updated. Only the tail of the active range is visited, so the cost is
+ * proportional to the number of tracks killed in the step (plus a fill of the
+ * vacancy indices).
+ *
+ * Afterward, the active range is reduced to the live tracks and the vacancies
+ * are all the slots beyond it, stored in decreasing order so that new tracks
+ * are initialized into the lowest empty slots. After \c initialize_tracks the
+ * active range is therefore <tt>states.size() - vacancies.size()</tt>:
+ * \verbatim
+
+   thread ID          | 0   1 2 3 4 5 6 7
+   track ID (before)  | 10  X 8 X 5 4 X X
+   vacancies (before) | 1 3 6 7
+   track ID (after)   | 10  5 8 4 X X X X
+   vacancies (after)  | 7 6 5 4
+
+   \endverbatim
+ *
+ * Compaction can also be applied before the first step, with an empty active
+ * range and no vacancies, to have primaries fill the front of the track
+ * vector.
+ */
+template<MemSpace M>
+inline void
+compact_tracks(const ParamsData<Ownership::const_reference, M>& params,
+               StateData<Ownership::reference, M>*              states,
+               TrackInitStateData<Ownership::value, M>*         data)
+{
+    CELER_EXPECT(params);
+    CELER_EXPECT(states && *states);
+    CELER_EXPECT(data && *data);
+    CELER_EXPECT(data->vacancies.size() <= states->num_active);
+
+    size_type num_alive = states->num_active - data->vacancies.size();
+    if (num_alive < states->num_active)
+    {
+        // Launch a kernel to move live tracks into the holes
+        detail::compact_tracks(params, *states, make_ref(*data), num_alive);
+    }
+
+    // All slots beyond the live tracks are empty
+    data->vacancies.resize(states->size() - num_alive);
+    detail::fill_vacancies<M>(data->vacancies.data(), num_alive);
+    states->num_active = num_alive;
+}
+
 //---------------------------------------------------------------------------//
 } // namespace celeritas
@@ -0,0 +1,188 @@
+//----------------------------------*-C++-*----------------------------------//
+// Copyright 2021 UT-Battelle, LLC, and other Celeritas developers.
+// See the top-level COPYRIGHT file for details.
+// SPDX-License-Identifier: (Apache-2.0 OR MIT)
+//---------------------------------------------------------------------------//
+//! \file CompactTracksLauncher.hh
+//---------------------------------------------------------------------------//
+#pragma once
+
+#include "base/Algorithms.hh"
+#include "base/Span.hh"
+#include "geometry/GeoTrackView.hh"
+#include "sim/TrackData.hh"
+#include "sim/TrackInitData.hh"
+#include "Utils.hh"
+
+namespace celeritas
+{
+namespace detail
+{
+//---------------------------------------------------------------------------//
+/*!
+ * Find the empty slot in the dense prefix that a live track will move to.
+ *
+ * The vacancies are the sorted indices of the empty slots in the active
+ * range. The first vacancies (those below \c num_alive) are the "holes" that
+ * must be filled, and the rest are the empty slots in the tail. The live
+ * tracks in the tail are paired with the holes in order, so the destination
+ * of a live track is the hole whose index is the number of live tracks in the
+ * tail that precede it.
+ */
+inline CELER_FUNCTION ThreadId find_compacted_slot(
+    Span<const size_type> vacancies, size_type num_alive, ThreadId src)
+{
+    CELER_EXPECT(src.get() >= num_alive);
+
+    // Empty slots in the tail
+    const size_type* tail_begin
+        = celeritas::lower_bound(vacancies.begin(), vacancies.end(), num_alive);
+    const size_type* tail_end
+        = celeritas::lower_bound(tail_begin, vacancies.end(), src.get());
+
+    // Number of live tracks in the tail before this one
+    size_type idx = src.get() - num_alive - size_type(tail_end - tail_begin);
+    CELER_ASSERT(idx < size_type(tail_begin - vacancies.begin()));
+    return ThreadId{vacancies[idx]};
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * Move live tracks from the tail of the active range into the dense prefix.
+ *
+ * Each thread visits one slot in the tail \f$ [n_\mathrm{alive},
+ * n_\mathrm{active}) \f$. If the slot holds a live track, its persistent
+ * state is copied to a hole in \f$ [0, n_\mathrm{alive}) \f$. The tail slot
+ * is then marked as empty and its selected model and energy deposition are
+ * cleared, since it will no longer be visited by the step kernels that would
+ * otherwise reset them.
+ *
+ * Scratch data that is recalculated every step (cross sections, step length,
+ * energy deposition) and the already-processed interaction are not copied, so
+ * any per-step tallies must be scored before compaction.
+ */
+template<MemSpace M>
+class CompactTracksLauncher
+{
+  public:
+    //!@{
+    //! Type aliases
+    using ParamsDataRef         = ParamsData<Ownership::const_reference, M>;
+    using StateDataRef          = StateData<Ownership::reference, M>;
+    using TrackInitStateDataRef = TrackInitStateData<Ownership::reference, M>;
+    //!@}
+
+  public:
+    // Construct with shared and state data
+    CELER_FUNCTION CompactTracksLauncher(const ParamsDataRef&         params,
+                                         const StateDataRef&          states,
+                                         const TrackInitStateDataRef& data,
+                                         size_type num_alive)
+        : params_(params)
+        , states_(states)
+        , vacancies_(data.vacancies.storage[AllItems<size_type, M>{}].first(
+              data.vacancies.size()))
+        , num_alive_(num_alive)
+    {
+        CELER_EXPECT(params_);
+        CELER_EXPECT(states_);
+        CELER_EXPECT(num_alive_ <= states_.num_active);
+    }
+
+    // Move the track in the given tail slot
+    inline CELER_FUNCTION void operator()(ThreadId tid) const;
+
+  private:
+    const ParamsDataRef&  params_;
+    const StateDataRef&   states_;
+    Span<const size_type> vacancies_;
+    size_type             num_alive_;
+};
+
+//---------------------------------------------------------------------------//
+/*!
+ * Update the parent thread IDs of new initializers after compaction.
+ *
+ * Every parent slot holds a live track (if the parent was killed, its slot
+ * was filled by its first secondary), so any parent in the tail was moved.
+ */
+template<MemSpace M>
+class RemapParentsLauncher
+{
+  public:
+    //!@{
+    //! Type aliases
+    using TrackInitStateDataRef = TrackInitStateData<Ownership::reference, M>;
+    //!@}
+
+  public:
+    // Construct with state data
+    CELER_FUNCTION RemapParentsLauncher(const TrackInitStateDataRef& data,
+                                        size_type num_alive)
+        : data_(data)
+        , vacancies_(data.vacancies.storage[AllItems<size_type, M>{}].first(
+              data.vacancies.size()))
+        , num_alive_(num_alive)
+    {
+    }
+
+    // Update the parent of the given initializer
+    inline CELER_FUNCTION void operator()(ThreadId tid) const;
+
+  private:
+    const TrackInitStateDataRef& data_;
+    Span<const size_type>        vacancies_;
+    size_type                    num_alive_;
+};
+
+//---------------------------------------------------------------------------//
+/*!
+ * Move the track in the given tail slot.
+ */
+template<MemSpace M>
+CELER_FUNCTION void CompactTracksLauncher<M>::operator()(ThreadId tid) const
+{
+    ThreadId src{num_alive_ + tid.get()};
+    CELER_ASSERT(src < states_.num_active);
+
+    if (states_.sim.state[src].alive)
+    {
+        ThreadId dst = find_compacted_slot(vacancies_, num_alive_, src);
+        CELER_ASSERT(dst.get() < num_alive_);
+        CELER_ASSERT(!states_.sim.state[dst].alive);
+
+        states_.sim.state[dst]       = states_.sim.state[src];
+        states_.particles.state[dst] = states_.particles.state[src];
+        states_.materials.state[dst] = states_.materials.state[src];
+        states_.physics.state[dst]   = states_.physics.state[src];
+        states_.rng.rng[dst]         = states_.rng.rng[src];
+
+        // Copy the navigation state, position, and direction
+        GeoTrackView src_geo(params_.geometry, states_.geometry, src);
+        GeoTrackView dst_geo(params_.geometry, states_.geometry, dst);
+        dst_geo = GeoTrackView::DetailedInitializer{src_geo, src_geo.dir()};
+    }
+
+    // Vacate the tail slot
+    states_.sim.state[src].alive        = false;
+    states_.physics.state[src].model_id = {};
+    states_.energy_deposition[src]      = 0;
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * Update the parent of the given initializer.
+ */
+template<MemSpace M>
+CELER_FUNCTION void RemapParentsLauncher<M>::operator()(ThreadId tid) const
+{
+    ThreadId& parent = data_.parents[tid];
+    if (parent.get() >= num_alive_)
+    {
+        parent = find_compacted_slot(vacancies_, num_alive_, parent);
+    }
+}
+
+//---------------------------------------------------------------------------//
+} // namespace detail
+} // namespace celeritas
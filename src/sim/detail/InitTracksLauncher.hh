@@ -121,6 +121,9 @@ CELER_FUNCTION void InitTracksLauncher<M>::operator()(ThreadId tid) const
         phys = {};
     }
 
+    // Start the random number stream
+    init_rng_stream(states_.rng, vac_id, init.sim.event_id, init.sim.track_id);
+
     // Interaction representing creation of a new track
     {
         states_.interactions[vac_id].action = Action::spawned;
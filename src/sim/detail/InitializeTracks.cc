@@ -7,6 +7,9 @@
 //---------------------------------------------------------------------------//
 #include "InitializeTracks.hh"
 
+#include <iterator>
+#include <numeric>
+#include "CompactTracksLauncher.hh"
 #include "InitTracksLauncher.hh"
 #include "LocateAliveLauncher.hh"
 #include "ProcessPrimariesLauncher.hh"
@@ -45,7 +48,7 @@ void locate_alive(const ParamsHostRef&         params,
 {
     LocateAliveLauncher<MemSpace::host> launch(params, states, data);
 #pragma omp parallel for
-    for (size_type i = 0; i < states.size(); ++i)
+    for (size_type i = 0; i < states.num_active; ++i)
     {
         launch(ThreadId{i});
     }
@@ -75,12 +78,37 @@ void process_secondaries(const ParamsHostRef&         params,
 {
     ProcessSecondariesLauncher<MemSpace::host> launch(params, states, data);
 #pragma omp parallel for
-    for (size_type i = 0; i < states.size(); ++i)
+    for (size_type i = 0; i < states.num_active; ++i)
     {
         launch(ThreadId{i});
     }
 }
 
+//---------------------------------------------------------------------------//
+/*!
+ * Move live tracks into the front of the track vector on host.
+ */
+void compact_tracks(const ParamsHostRef&         params,
+                    const StateHostRef&          states,
+                    const TrackInitStateHostRef& data,
+                    size_type                    num_alive)
+{
+    CompactTracksLauncher<MemSpace::host> launch(
+        params, states, data, num_alive);
+#pragma omp parallel for
+    for (size_type i = 0; i < states.num_active - num_alive; ++i)
+    {
+        launch(ThreadId{i});
+    }
+
+    RemapParentsLauncher<MemSpace::host> remap(data, num_alive);
+#pragma omp parallel for
+    for (size_type i = 0; i < data.parents.size(); ++i)
+    {
+        remap(ThreadId{i});
+    }
+}
+
 //---------------------------------------------------------------------------//
 /*!
  * Remove all elements in the vacancy vector that were flagged as active
@@ -129,6 +157,21 @@ void exclusive_scan_counts<MemSpace::host>(Span<size_type> counts)
     }
 }
 
+//---------------------------------------------------------------------------//
+/*!
+ * Fill the vacancies with decreasing slot indices that end at \c start.
+ *
+ * Since new tracks are initialized from the back of the vacancy vector, the
+ * lowest empty slots are filled first.
+ */
+template<>
+void fill_vacancies<MemSpace::host>(Span<size_type> vacancies, size_type start)
+{
+    std::iota(std::make_reverse_iterator(vacancies.end()),
+              std::make_reverse_iterator(vacancies.begin()),
+              start);
+}
+
 //---------------------------------------------------------------------------//
 } // namespace detail
 } // namespace celeritas
@@ -8,10 +8,13 @@
 #include "InitializeTracks.hh"
 
 #include <thrust/device_ptr.h>
+#include <thrust/iterator/reverse_iterator.h>
 #include <thrust/reduce.h>
 #include <thrust/remove.h>
 #include <thrust/scan.h>
+#include <thrust/sequence.h>
 #include "base/KernelParamCalculator.cuda.hh"
+#include "CompactTracksLauncher.hh"
 #include "InitTracksLauncher.hh"
 #include "LocateAliveLauncher.hh"
 #include "ProcessPrimariesLauncher.hh"
@@ -53,7 +56,7 @@ __global__ void locate_alive_kernel(const ParamsDeviceRef         params,
                                     const TrackInitStateDeviceRef data)
 {
     auto tid = KernelParamCalculator::thread_id();
-    if (!(tid < states.size()))
+    if (!(tid < states.num_active))
         return;
 
     LocateAliveLauncher<MemSpace::device> launch(params, states, data);
@@ -84,12 +87,45 @@ __global__ void process_secondaries_kernel(const ParamsDeviceRef params,
                                            const TrackInitStateDeviceRef data)
 {
     auto tid = KernelParamCalculator::thread_id();
-    if (!(tid < states.size()))
+    if (!(tid < states.num_active))
         return;
 
     ProcessSecondariesLauncher<MemSpace::device> launch(params, states, data);
     launch(tid);
 }
+
+//---------------------------------------------------------------------------//
+/*!
+ * Move live tracks in the tail of the active range into empty slots.
+ */
+__global__ void compact_tracks_kernel(const ParamsDeviceRef         params,
+                                      const StateDeviceRef          states,
+                                      const TrackInitStateDeviceRef data,
+                                      size_type                     num_alive)
+{
+    auto tid = KernelParamCalculator::thread_id();
+    if (!(tid < states.num_active - num_alive))
+        return;
+
+    CompactTracksLauncher<MemSpace::device> launch(
+        params, states, data, num_alive);
+    launch(tid);
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * Update the parents of new track initializers after compaction.
+ */
+__global__ void
+remap_parents_kernel(const TrackInitStateDeviceRef data, size_type num_alive)
+{
+    auto tid = KernelParamCalculator::thread_id();
+    if (!(tid < data.parents.size()))
+        return;
+
+    RemapParentsLauncher<MemSpace::device> launch(data, num_alive);
+    launch(tid);
+}
 } // end namespace
 
 //---------------------------------------------------------------------------//
@@ -127,7 +163,7 @@ void locate_alive(const ParamsDeviceRef&         params,
                   const StateDeviceRef&          states,
                   const TrackInitStateDeviceRef& data)
 {
-    LAUNCH_KERNEL(locate_alive, states.size(), params, states, data);
+    LAUNCH_KERNEL(locate_alive, states.num_active, params, states, data);
 }
 
 //---------------------------------------------------------------------------//
@@ -153,7 +189,31 @@ void process_secondaries(const ParamsDeviceRef&         params,
     CELER_EXPECT(states.size() <= data.secondary_counts.size());
     CELER_EXPECT(states.size() <= states.interactions.size());
 
-    LAUNCH_KERNEL(process_secondaries, states.size(), params, states, data);
+    LAUNCH_KERNEL(
+        process_secondaries, states.num_active, params, states, data);
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * Move live tracks into the front of the track vector.
+ */
+void compact_tracks(const ParamsDeviceRef&         params,
+                    const StateDeviceRef&          states,
+                    const TrackInitStateDeviceRef& data,
+                    size_type                      num_alive)
+{
+    CELER_EXPECT(num_alive < states.num_active);
+
+    LAUNCH_KERNEL(compact_tracks,
+                  states.num_active - num_alive,
+                  params,
+                  states,
+                  data,
+                  num_alive);
+    if (data.parents.size() > 0)
+    {
+        LAUNCH_KERNEL(remap_parents, data.parents.size(), data, num_alive);
+    }
 }
 
 //---------------------------------------------------------------------------//
@@ -213,6 +273,25 @@ void exclusive_scan_counts<MemSpace::device>(Span<size_type> counts)
     CELER_CUDA_CHECK_ERROR();
 }
 
+//---------------------------------------------------------------------------//
+/*!
+ * Fill the vacancies with decreasing slot indices that end at \c start.
+ *
+ * Since new tracks are initialized from the back of the vacancy vector, the
+ * lowest empty slots are filled first.
+ */
+template<>
+void fill_vacancies<MemSpace::device>(Span<size_type> vacancies,
+                                      size_type       start)
+{
+    auto begin = thrust::device_pointer_cast(vacancies.data());
+    thrust::sequence(thrust::make_reverse_iterator(begin + vacancies.size()),
+                     thrust::make_reverse_iterator(begin),
+                     start);
+
+    CELER_CUDA_CHECK_ERROR();
+}
+
 //---------------------------------------------------------------------------//
 #undef LAUNCH_KERNEL
 } // namespace detail
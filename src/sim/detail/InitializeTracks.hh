@@ -50,6 +50,17 @@ void process_secondaries(const ParamsHostRef&         params,
                          const StateHostRef&          states,
                          const TrackInitStateHostRef& data);
 
+//---------------------------------------------------------------------------//
+// Move live tracks beyond the given number into the empty slots before it
+void compact_tracks(const ParamsDeviceRef&         params,
+                    const StateDeviceRef&          states,
+                    const TrackInitStateDeviceRef& data,
+                    size_type                      num_alive);
+void compact_tracks(const ParamsHostRef&         params,
+                    const StateHostRef&          states,
+                    const TrackInitStateHostRef& data,
+                    size_type                    num_alive);
+
 //---------------------------------------------------------------------------//
 // Remove all elements in the vacancy vector that were flagged as alive
 template<MemSpace M>
@@ -80,6 +91,17 @@ void exclusive_scan_counts<MemSpace::host>(Span<size_type> counts);
 template<>
 void exclusive_scan_counts<MemSpace::device>(Span<size_type> counts);
 
+//---------------------------------------------------------------------------//
+// Fill the vacancies with decreasing slot indices that end at the given value
+template<MemSpace M>
+void fill_vacancies(Span<size_type> vacancies, size_type start);
+
+template<>
+void fill_vacancies<MemSpace::host>(Span<size_type> vacancies, size_type start);
+template<>
+void fill_vacancies<MemSpace::device>(Span<size_type> vacancies,
+                                      size_type       start);
+
 //---------------------------------------------------------------------------//
 // INLINE FUNCTION DEFINITIONS
 //---------------------------------------------------------------------------//
@@ -110,6 +132,14 @@ inline void process_secondaries(const ParamsDeviceRef&,
 {
     CELER_NOT_CONFIGURED("CUDA");
 }
+
+inline void compact_tracks(const ParamsDeviceRef&,
+                           const StateDeviceRef&,
+                           const TrackInitStateDeviceRef&,
+                           size_type)
+{
+    CELER_NOT_CONFIGURED("CUDA");
+}
 #endif
 //---------------------------------------------------------------------------//
 } // namespace detail
@@ -121,6 +121,9 @@ CELER_FUNCTION void LocateAliveLauncher<M>::operator()(ThreadId tid) const
         PhysicsTrackView phys(params_.physics, states_.physics, {}, {}, tid);
         phys = {};
 
+        // Start the random number stream
+        init_rng_stream(states_.rng, tid, sim.event_id(), sim.track_id());
+
         // Mark the secondary as processed and the track as active
         --data_.secondary_counts[tid];
         secondary            = Secondary{};
@@ -7,9 +7,12 @@
 //---------------------------------------------------------------------------//
 #pragma once
 
+#include "celeritas_config.h"
 #include "base/Assert.hh"
 #include "base/NumericLimits.hh"
 #include "base/Types.hh"
+#include "random/RngData.hh"
+#include "sim/Types.hh"
 
 namespace celeritas
 {
@@ -38,6 +41,40 @@ CELER_FORCEINLINE_FUNCTION ThreadId from_back(size_type size, ThreadId tid)
     return ThreadId{size - tid.get() - 1};
 }
 
+//---------------------------------------------------------------------------//
+/*!
+ * Start the random number stream of a new track.
+ *
+ * With the counter-based generator, the stream is determined by the event and
+ * track IDs, so the random numbers sampled by a track are independent of the
+ * slot it occupies. The cuRAND generator simply continues the sequence of the
+ * track slot.
+ */
+#if CELERITAS_RNG == CELERITAS_RNG_PHILOX
+template<MemSpace M>
+inline CELER_FUNCTION void
+init_rng_stream(const RngStateData<Ownership::reference, M>& rng,
+                ThreadId                                     tid,
+                EventId                                      event,
+                TrackId                                      track)
+{
+    CELER_EXPECT(event && track);
+    CELER_EXPECT(tid < rng.size());
+    detail::philox_select_stream(
+        (static_cast<ull_int>(event.get()) << 32) | track.get(),
+        &rng.rng[tid].state);
+}
+#else
+template<MemSpace M>
+inline CELER_FUNCTION void
+init_rng_stream(const RngStateData<Ownership::reference, M>&,
+                ThreadId,
+                EventId,
+                TrackId)
+{
+}
+#endif
+
 //---------------------------------------------------------------------------//
 } // namespace detail
 } // namespace celeritas
@@ -0,0 +1,161 @@
+//----------------------------------*-C++-*----------------------------------//
+// Copyright 2021 UT-Battelle, LLC, and other Celeritas developers.
+// See the top-level COPYRIGHT file for details.
+// SPDX-License-Identifier: (Apache-2.0 OR MIT)
+//---------------------------------------------------------------------------//
+//! \file ModelSorter.test.cc
+//---------------------------------------------------------------------------//
+#include "demo-loop/ModelSorter.hh"
+
+#include <vector>
+#include "base/CollectionBuilder.hh"
+#include "base/Copier.hh"
+#include "base/Range.hh"
+#include "celeritas_test.hh"
+
+using namespace celeritas;
+using demo_loop::ModelSorter;
+
+//---------------------------------------------------------------------------//
+// TEST HARNESS
+//---------------------------------------------------------------------------//
+
+class ModelSorterTest : public celeritas::Test
+{
+  protected:
+    using StateRef = StateData<Ownership::reference, MemSpace::host>;
+
+    // Assign the selected model (or -1 for none) of each track slot
+    void set_models(const std::vector<int>& model_ids)
+    {
+        resize(&physics_.state, model_ids.size());
+        resize(&particles_.state, model_ids.size());
+        for (auto i : range(model_ids.size()))
+        {
+            physics_.state[ThreadId(i)].model_id
+                = model_ids[i] >= 0 ? ModelId(model_ids[i]) : ModelId{};
+        }
+
+        // The sorter only accesses the physics state
+        states_.physics   = physics_;
+        states_.particles = particles_;
+    }
+
+    // Track slots that selected the model, as visited by the unsorted path
+    std::vector<size_type> unsorted_thread_ids(ModelId model) const
+    {
+        std::vector<size_type> result;
+        for (auto tid : range(ThreadId{states_.size()}))
+        {
+            if (physics_.state[tid].model_id == model)
+            {
+                result.push_back(tid.get());
+            }
+        }
+        return result;
+    }
+
+    PhysicsStateData<Ownership::value, MemSpace::host>  physics_;
+    ParticleStateData<Ownership::value, MemSpace::host> particles_;
+    StateRef                                            states_;
+};
+
+std::vector<size_type> to_vec(Span<const ThreadId> thread_ids)
+{
+    std::vector<size_type> result;
+    for (ThreadId tid : thread_ids)
+    {
+        result.push_back(tid.get());
+    }
+    return result;
+}
+
+std::vector<size_type> device_to_vec(Span<const ThreadId> thread_ids)
+{
+    std::vector<ThreadId> host_ids(thread_ids.size());
+    if (!host_ids.empty())
+    {
+        Copier<ThreadId, MemSpace::device> copy{thread_ids};
+        copy(MemSpace::host, make_span(host_ids));
+    }
+    return to_vec(make_span(host_ids));
+}
+
+//---------------------------------------------------------------------------//
+// TESTS
+//---------------------------------------------------------------------------//
+
+TEST_F(ModelSorterTest, sorted)
+{
+    const size_type num_models = 4;
+    this->set_models({2, -1, 0, 2, 1, -1, 0, 0, 2, -1});
+
+    ModelSorter<MemSpace::host> sort_tracks(num_models, states_.size());
+    sort_tracks(states_);
+
+    // Slots are grouped by model and keep their original order
+    static const size_type expected_0[] = {2, 6, 7};
+    EXPECT_VEC_EQ(expected_0, to_vec(sort_tracks.thread_ids(ModelId{0})));
+    static const size_type expected_1[] = {4};
+    EXPECT_VEC_EQ(expected_1, to_vec(sort_tracks.thread_ids(ModelId{1})));
+    static const size_type expected_2[] = {0, 3, 8};
+    EXPECT_VEC_EQ(expected_2, to_vec(sort_tracks.thread_ids(ModelId{2})));
+    EXPECT_EQ(0, sort_tracks.thread_ids(ModelId{3}).size());
+
+    // Each model visits the same slots as the unsorted path
+    for (auto model : range(ModelId{num_models}))
+    {
+        EXPECT_VEC_EQ(this->unsorted_thread_ids(model),
+                      to_vec(sort_tracks.thread_ids(model)));
+    }
+
+    // Resorting after the selected models change
+    this->set_models({-1, 3, 3, -1, 0, 1, -1, 2, 2, 0});
+    sort_tracks(states_);
+    for (auto model : range(ModelId{num_models}))
+    {
+        EXPECT_VEC_EQ(this->unsorted_thread_ids(model),
+                      to_vec(sort_tracks.thread_ids(model)));
+    }
+}
+
+TEST_F(ModelSorterTest, no_interactions)
+{
+    const size_type num_models = 2;
+    this->set_models(std::vector<int>(8, -1));
+
+    ModelSorter<MemSpace::host> sort_tracks(num_models, states_.size());
+    sort_tracks(states_);
+    for (auto model : range(ModelId{num_models}))
+    {
+        EXPECT_EQ(0, sort_tracks.thread_ids(model).size());
+    }
+}
+
+TEST_F(ModelSorterTest, TEST_IF_CELERITAS_CUDA(device))
+{
+    using DeviceRef = StateData<Ownership::reference, MemSpace::device>;
+
+    const size_type num_models = 4;
+    this->set_models({2, -1, 0, 2, 1, -1, 0, 0, 2, -1});
+
+    // Copy the selected models to device
+    PhysicsStateData<Ownership::value, MemSpace::device>  physics;
+    ParticleStateData<Ownership::value, MemSpace::device> particles;
+    physics   = physics_;
+    particles = particles_;
+    DeviceRef device_states;
+    device_states.physics   = physics;
+    device_states.particles = particles;
+
+    ModelSorter<MemSpace::device> sort_tracks(num_models,
+                                              device_states.size());
+    sort_tracks(device_states);
+
+    // The device sort matches the stable host sort
+    for (auto model : range(ModelId{num_models}))
+    {
+        EXPECT_VEC_EQ(this->unsorted_thread_ids(model),
+                      device_to_vec(sort_tracks.thread_ids(model)));
+    }
+}
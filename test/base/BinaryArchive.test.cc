@@ -0,0 +1,63 @@
+//----------------------------------*-C++-*----------------------------------//
+// Copyright 2021 UT-Battelle, LLC, and other Celeritas developers.
+// See the top-level COPYRIGHT file for details.
+// SPDX-License-Identifier: (Apache-2.0 OR MIT)
+//---------------------------------------------------------------------------//
+//! \file BinaryArchive.test.cc
+//---------------------------------------------------------------------------//
+#include "base/BinaryArchive.hh"
+
+#include <sstream>
+#include "celeritas_test.hh"
+
+using namespace celeritas;
+
+template<class T>
+using HostItems  = Collection<T, Ownership::value, MemSpace::host>;
+using AllDoubles = AllItems<double, MemSpace::host>;
+
+//---------------------------------------------------------------------------//
+// TESTS
+//---------------------------------------------------------------------------//
+
+TEST(BinaryArchiveTest, round_trip)
+{
+    HostItems<double> values;
+    {
+        const double data[] = {1.5, -2.25, 1e300};
+        make_builder(&values).insert_back(std::begin(data), std::end(data));
+    }
+
+    std::stringstream ss;
+    BinaryWriter      write(&ss);
+    write(123)(values)('x');
+
+    int               i = 0;
+    HostItems<double> read_values;
+    char              c = 0;
+    BinaryReader      read(&ss);
+    read(i)(read_values)(c);
+
+    EXPECT_EQ(123, i);
+    EXPECT_EQ('x', c);
+    EXPECT_VEC_EQ(values[AllDoubles{}], read_values[AllDoubles{}]);
+    EXPECT_EQ(write.checksum(), read.checksum());
+
+    // Reading past the end is an error
+    EXPECT_THROW(read(c), RuntimeError);
+}
+
+TEST(BinaryArchiveTest, checksum)
+{
+    BinaryWriter hash_a;
+    BinaryWriter hash_b;
+    EXPECT_EQ(hash_a.checksum(), hash_b.checksum());
+
+    hash_a(1)(2);
+    hash_b(2)(1);
+    EXPECT_NE(hash_a.checksum(), hash_b.checksum());
+
+    BinaryWriter hash_c;
+    hash_c(1)(2);
+    EXPECT_EQ(hash_a.checksum(), hash_c.checksum());
+}
@@ -187,6 +187,63 @@ TEST_F(LinearPropagatorHostTest, track_intraVolume)
         EXPECT_SOFT_EQ(16, geo.pos()[2]);
         EXPECT_EQ(geom.id_to_label(step.volume), "Envelope");
     }
+    {
+        // Short steps without querying the distance to the boundary
+        geo = {{-10, 10, 10}, {0, 0, 1}};
+
+        auto step = propagate(1.0); // boundary search limited to the step
+        EXPECT_SOFT_EQ(1.0, step.distance);
+        EXPECT_SOFT_EQ(11.0, geo.pos()[2]);
+        EXPECT_EQ(geom.id_to_label(step.volume), "Shape2");
+
+        step = propagate(1.5);
+        EXPECT_SOFT_EQ(1.5, step.distance);
+        EXPECT_EQ(geom.id_to_label(step.volume), "Shape2");
+        EXPECT_SOFT_EQ(2.5, geo.next_step()); // searched on demand
+
+        step = propagate(10.0); // boundary is closer than the step
+        EXPECT_SOFT_EQ(2.5, step.distance);
+        EXPECT_SOFT_EQ(15.0, geo.pos()[2]);
+        EXPECT_EQ(geom.id_to_label(step.volume), "Shape1");
+
+        step = propagate(10.0); // limited search after crossing
+        EXPECT_SOFT_EQ(1.0, step.distance);
+        EXPECT_EQ(geom.id_to_label(step.volume), "Envelope");
+    }
+}
+
+//----------------------------------------------------------------------------//
+
+TEST_F(LinearPropagatorHostTest, safety_cache)
+{
+    GeoTrackView     geo = this->make_geo_track_view();
+    LinearPropagator propagate(&geo);
+
+    const auto& geom = *this->geo_params();
+    {
+        // Start at the center of Shape2 (a 10 cm box)
+        geo = {{-10, 10, 10}, {0, 0, 1}};
+        EXPECT_SOFT_EQ(0, geo.safety(geo.pos()));
+
+        // No boundary within the step: safety is cached at the start
+        auto step = propagate(1.0);
+        EXPECT_SOFT_EQ(1.0, step.distance);
+        EXPECT_SOFT_EQ(4.0, geo.safety(geo.pos()));
+
+        // Step inside the safety sphere
+        step = propagate(2.0);
+        EXPECT_SOFT_EQ(2.0, step.distance);
+        EXPECT_SOFT_EQ(13.0, geo.pos()[2]);
+        EXPECT_EQ(geom.id_to_label(step.volume), "Shape2");
+        EXPECT_SOFT_EQ(2.0, geo.safety(geo.pos()));
+        EXPECT_SOFT_EQ(2.0, geo.next_step());
+
+        // Crossing a boundary invalidates the sphere
+        step = propagate(10.0);
+        EXPECT_SOFT_EQ(2.0, step.distance);
+        EXPECT_EQ(geom.id_to_label(step.volume), "Shape1");
+        EXPECT_SOFT_EQ(0, geo.safety(geo.pos()));
+    }
 }
 
 //---------------------------------------------------------------------------//
@@ -65,6 +65,13 @@
 #    define TEST_IF_CELERITAS_CUDA(name) DISABLED_##name
 #endif
 
+//! Construct a test name that is disabled when physics tables are in float
+#if CELERITAS_SINGLE_PRECISION_TABLES
+#    define TEST_IF_CELERITAS_DOUBLE_TABLES(name) DISABLED_##name
+#else
+#    define TEST_IF_CELERITAS_DOUBLE_TABLES(name) name
+#endif
+
 //! Construct a test name that is disabled when ROOT is disabled
 #if CELERITAS_USE_ROOT
 #    define TEST_IF_CELERITAS_USE_ROOT(name) name
@@ -23,8 +23,7 @@ namespace pdg = celeritas::pdg;
 // TEST HARNESS
 //---------------------------------------------------------------------------//
 
-class EventReaderTest : public celeritas::Test,
-                        public testing::WithParamInterface<const char*>
+class EventReaderTest : public celeritas::Test
 {
   protected:
     void SetUp() override
@@ -64,11 +63,27 @@ class EventReaderTest : public celeritas::Test,
     std::shared_ptr<ParticleParams> particle_params_;
 };
 
+class EventReaderFormatTest : public EventReaderTest,
+                              public testing::WithParamInterface<const char*>
+{
+};
+
+//! Event IDs of a batch of primaries
+std::vector<int> event_ids(const std::vector<Primary>& primaries)
+{
+    std::vector<int> result;
+    for (const auto& primary : primaries)
+    {
+        result.push_back(primary.event_id.get());
+    }
+    return result;
+}
+
 //---------------------------------------------------------------------------//
 // TESTS
 //---------------------------------------------------------------------------//
 
-TEST_P(EventReaderTest, read_all_formats)
+TEST_P(EventReaderFormatTest, read_all_formats)
 {
     filename_ = this->test_data_path("io", GetParam());
 
@@ -113,8 +128,70 @@ TEST_P(EventReaderTest, read_all_formats)
     }
 }
 
+TEST_P(EventReaderFormatTest, read_batches)
+{
+    filename_ = this->test_data_path("io", GetParam());
+    EventReader read_event(filename_.c_str(), particle_params_);
+
+    // Events are never split, even if they exceed the primary limit
+    auto primaries = read_event(1, 2);
+    EXPECT_EQ(8, primaries.size());
+    for (const auto& primary : primaries)
+    {
+        EXPECT_EQ(0, primary.event_id.get());
+    }
+
+    // The record is exhausted
+    EXPECT_TRUE(read_event(1, 2).empty());
+    EXPECT_TRUE(read_event().empty());
+}
+
+TEST_F(EventReaderTest, read_multiple_batches)
+{
+    // Events with 8, 2, and 3 primaries
+    filename_ = this->test_data_path("io", "multi-event.hepmc3");
+    EventReader read_event(filename_.c_str(), particle_params_);
+
+    // The second event doesn't fit with the first and is held
+    auto primaries = read_event(10, 9);
+    EXPECT_EQ(8, primaries.size());
+    EXPECT_EQ(std::vector<int>(8, 0), event_ids(primaries));
+
+    // The held event starts the next batch, and event IDs continue
+    primaries = read_event(10, 5);
+    const int expected_event_ids[] = {1, 1, 2, 2, 2};
+    EXPECT_VEC_EQ(expected_event_ids, event_ids(primaries));
+    const double expected_energy[] = {1e3, 2.5e3, 3e3, 4e3, 5e3};
+    const int    expected_track_ids[] = {0, 1, 0, 1, 2};
+    for (auto i : celeritas::range(primaries.size()))
+    {
+        EXPECT_DOUBLE_EQ(expected_energy[i], primaries[i].energy.value());
+        EXPECT_EQ(expected_track_ids[i], primaries[i].track_id.get());
+    }
+
+    EXPECT_TRUE(read_event(10, 5).empty());
+}
+
+TEST_F(EventReaderTest, read_limited_events)
+{
+    filename_ = this->test_data_path("io", "multi-event.hepmc3");
+    EventReader read_event(filename_.c_str(), particle_params_);
+
+    // The event limit ends the batch before the primary limit
+    auto primaries = read_event(2, 100);
+    EXPECT_EQ(10, primaries.size());
+    EXPECT_EQ(1, primaries.back().event_id.get());
+
+    // A single event that exceeds the primary limit is still read
+    primaries = read_event(2, 1);
+    const int expected_event_ids[] = {2, 2, 2};
+    EXPECT_VEC_EQ(expected_event_ids, event_ids(primaries));
+
+    EXPECT_TRUE(read_event().empty());
+}
+
 INSTANTIATE_TEST_SUITE_P(EventReaderTests,
-                         EventReaderTest,
+                         EventReaderFormatTest,
                          testing::Values("event-record.hepmc3",
                                          "event-record.hepmc2",
                                          "event-record.hepevt"));
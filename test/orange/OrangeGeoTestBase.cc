@@ -14,10 +14,13 @@
 
 #include "base/Join.hh"
 #include "orange/Types.hh"
+#include "orange/construct/ConnectivityBuilder.hh"
 #include "orange/construct/SurfaceInput.hh"
 #include "orange/construct/SurfaceInserter.hh"
+#include "orange/construct/VolumeGridBuilder.hh"
 #include "orange/construct/VolumeInput.hh"
 #include "orange/construct/VolumeInserter.hh"
+#include "orange/surfaces/PlaneAligned.hh"
 #include "orange/surfaces/Sphere.hh"
 #include "orange/surfaces/SurfaceAction.hh"
 #include "orange/surfaces/SurfaceIO.hh"
@@ -190,6 +193,100 @@ void OrangeGeoTestBase::build_geometry(TwoVolInput inp)
     return this->build_impl(std::move(host_data));
 }
 
+//---------------------------------------------------------------------------//
+/*!
+ * Construct a lattice of unit cubes surrounded by an exterior volume.
+ *
+ * The cubes span [0, size] along each axis, and the exterior is the first
+ * volume.
+ */
+void OrangeGeoTestBase::build_geometry(LatticeInput inp)
+{
+    CELER_EXPECT(!params_);
+    CELER_EXPECT(inp.size > 0);
+    OrangeParamsData<Ownership::value, MemSpace::host> host_data;
+
+    const size_type num_planes = inp.size + 1;
+    auto plane_id = [num_planes](size_type ax, size_type i) {
+        return SurfaceId{ax * num_planes + i};
+    };
+
+    {
+        // Insert planes along x, then y, then z
+        SurfaceInserter insert(&host_data.surfaces);
+        const char      axis_names[] = "xyz";
+        for (auto ax : range(3))
+        {
+            for (auto i : range(num_planes))
+            {
+                real_type pos = i;
+                switch (ax)
+                {
+                    case 0:
+                        insert(PlaneX(pos));
+                        break;
+                    case 1:
+                        insert(PlaneY(pos));
+                        break;
+                    default:
+                        insert(PlaneZ(pos));
+                }
+                surf_names_.push_back(std::string("p") + axis_names[ax]
+                                      + std::to_string(i));
+            }
+        }
+    }
+    {
+        // Insert volumes
+        using namespace logic;
+        VolumeInserter insert(&host_data.volumes);
+        VolumeInput    vol;
+        vol.logic = {0, 1, lnot, land, 2, land, 3, lnot, land, 4, land, 5,
+                     lnot, land};
+        vol.num_intersections = 6;
+
+        // Exterior: outside the lattice bounding box
+        for (auto ax : range(3))
+        {
+            vol.faces.push_back(plane_id(ax, 0));
+            vol.faces.push_back(plane_id(ax, inp.size));
+        }
+        vol.logic.push_back(lnot);
+        insert(vol);
+        vol_names_.push_back("[EXTERIOR]");
+        vol.logic.pop_back();
+
+        // Cubes
+        for (auto i : range(inp.size))
+        {
+            for (auto j : range(inp.size))
+            {
+                for (auto k : range(inp.size))
+                {
+                    vol.faces = {plane_id(0, i),
+                                 plane_id(0, i + 1),
+                                 plane_id(1, j),
+                                 plane_id(1, j + 1),
+                                 plane_id(2, k),
+                                 plane_id(2, k + 1)};
+                    insert(vol);
+                    vol_names_.push_back(std::to_string(i) + ","
+                                         + std::to_string(j) + ","
+                                         + std::to_string(k));
+                }
+            }
+        }
+    }
+
+    // Save bbox, including some of the exterior
+    bbox_lower_ = {-1, -1, -1};
+    bbox_upper_ = {real_type(inp.size + 1),
+                   real_type(inp.size + 1),
+                   real_type(inp.size + 1)};
+
+    return this->build_impl(std::move(host_data));
+}
+
 //---------------------------------------------------------------------------//
 /*!
  * Print geometry description.
@@ -298,6 +395,24 @@ void OrangeGeoTestBase::build_impl(ParamsHostValue&& host_data)
     host_data.scalars.max_faces         = max_faces;
     host_data.scalars.max_intersections = max_intersections;
 
+    {
+        // Build the acceleration grid for volume initialization
+        SurfaceData<Ownership::const_reference, MemSpace::host> surfaces;
+        VolumeData<Ownership::const_reference, MemSpace::host>  volumes;
+        surfaces = host_data.surfaces;
+        volumes  = host_data.volumes;
+        VolumeGridBuilder build_grid(&host_data.volume_grid);
+        build_grid(surfaces, volumes);
+    }
+
+    {
+        // Build the surface neighbors for boundary crossing
+        VolumeData<Ownership::const_reference, MemSpace::host> volumes;
+        volumes = host_data.volumes;
+        ConnectivityBuilder build_connectivity(&host_data.connectivity);
+        build_connectivity(host_data.surfaces.size(), volumes);
+    }
+
     sense_storage_.resize(max_faces);
 
     // Construct device values and device/host references
@@ -35,6 +35,7 @@ class OrangeGeoTestBase : public celeritas::Test
     //!@{
     //! Type aliases
     using real_type = celeritas::real_type;
+    using size_type = celeritas::size_type;
     using Real3     = celeritas::Real3;
     using Sense     = celeritas::Sense;
     using VolumeId  = celeritas::VolumeId;
@@ -56,6 +57,10 @@ class OrangeGeoTestBase : public celeritas::Test
     {
         real_type radius = 1;
     };
+    struct LatticeInput
+    {
+        size_type size = 2; //!< Number of unit cubes along each axis
+    };
     //!@}
 
   public:
@@ -77,6 +82,9 @@ class OrangeGeoTestBase : public celeritas::Test
     // Load geometry with two volumes separated by a spherical surface
     void build_geometry(TwoVolInput);
 
+    // Load geometry with a lattice of unit cubes
+    void build_geometry(LatticeInput);
+
     //! Get the data after loading
     const ParamsHostRef& params_host_ref() const
     {
@@ -0,0 +1,86 @@
+//----------------------------------*-C++-*----------------------------------//
+// Copyright 2021 UT-Battelle, LLC, and other Celeritas developers.
+// See the top-level COPYRIGHT file for details.
+// SPDX-License-Identifier: (Apache-2.0 OR MIT)
+//---------------------------------------------------------------------------//
+//! \file ConnectivityBuilder.test.cc
+//---------------------------------------------------------------------------//
+#include "orange/construct/ConnectivityBuilder.hh"
+
+#include "celeritas_test.hh"
+#include "orange/construct/VolumeInput.hh"
+#include "orange/construct/VolumeInserter.hh"
+
+using namespace celeritas;
+
+//---------------------------------------------------------------------------//
+// TEST HARNESS
+//---------------------------------------------------------------------------//
+
+class ConnectivityBuilderTest : public celeritas::Test
+{
+  protected:
+    std::vector<int> neighbors(SurfaceId::size_type surf) const
+    {
+        std::vector<int> result;
+        for (VolumeId id :
+             connectivity_.volumes[connectivity_.neighbors[SurfaceId{surf}]])
+        {
+            result.push_back(id.unchecked_get());
+        }
+        return result;
+    }
+
+    VolumeData<Ownership::value, MemSpace::host>       volume_data_;
+    ConnectivityData<Ownership::value, MemSpace::host> connectivity_;
+};
+
+//---------------------------------------------------------------------------//
+// TESTS
+//---------------------------------------------------------------------------//
+
+TEST_F(ConnectivityBuilderTest, all)
+{
+    {
+        VolumeInserter insert(&volume_data_);
+        VolumeInput    input;
+
+        // Outside the sphere (surface 2)
+        input.faces = {SurfaceId{2}};
+        input.logic = {0};
+        insert(input);
+
+        // Inside the sphere, between two planes
+        input.faces = {SurfaceId{0}, SurfaceId{1}, SurfaceId{2}};
+        input.logic
+            = {0, 1, logic::lnot, logic::land, 2, logic::lnot, logic::land};
+        insert(input);
+
+        // Inside the sphere, below the first plane
+        input.faces = {SurfaceId{0}, SurfaceId{2}};
+        input.logic = {0, logic::lnot, 1, logic::lnot, logic::land};
+        insert(input);
+
+        // Everywhere
+        input.faces = {};
+        input.logic = {logic::ltrue};
+        insert(input);
+    }
+
+    {
+        VolumeData<Ownership::const_reference, MemSpace::host> volumes;
+        volumes = volume_data_;
+        ConnectivityBuilder build_connectivity(&connectivity_);
+        build_connectivity(4, volumes);
+    }
+    ASSERT_TRUE(connectivity_);
+    EXPECT_EQ(4, connectivity_.neighbors.size());
+
+    static const int expected_neighbors_0[] = {1, 2};
+    EXPECT_VEC_EQ(expected_neighbors_0, neighbors(0));
+    static const int expected_neighbors_1[] = {1};
+    EXPECT_VEC_EQ(expected_neighbors_1, neighbors(1));
+    static const int expected_neighbors_2[] = {0, 1, 2};
+    EXPECT_VEC_EQ(expected_neighbors_2, neighbors(2));
+    EXPECT_EQ(0, neighbors(3).size());
+}
@@ -0,0 +1,153 @@
+//----------------------------------*-C++-*----------------------------------//
+// Copyright 2021 UT-Battelle, LLC, and other Celeritas developers.
+// See the top-level COPYRIGHT file for details.
+// SPDX-License-Identifier: (Apache-2.0 OR MIT)
+//---------------------------------------------------------------------------//
+//! \file VolumeGridBuilder.test.cc
+//---------------------------------------------------------------------------//
+#include "orange/construct/VolumeGridBuilder.hh"
+
+#include <limits>
+
+#include "celeritas_test.hh"
+#include "orange/construct/SurfaceInserter.hh"
+#include "orange/construct/VolumeInput.hh"
+#include "orange/construct/VolumeInserter.hh"
+#include "orange/surfaces/CylCentered.hh"
+#include "orange/surfaces/PlaneAligned.hh"
+#include "orange/surfaces/Sphere.hh"
+#include "orange/universes/detail/Utils.hh"
+
+using namespace celeritas;
+using celeritas::detail::find_candidates;
+
+//---------------------------------------------------------------------------//
+// TEST HARNESS
+//---------------------------------------------------------------------------//
+
+class VolumeGridBuilderTest : public celeritas::Test
+{
+  protected:
+    void SetUp() override
+    {
+        SurfaceInserter insert_surface(&surface_data_);
+        insert_surface(PlaneX(0));
+        insert_surface(PlaneX(2));
+        insert_surface(PlaneY(0));
+        insert_surface(PlaneY(1));
+        insert_surface(Sphere({0.5, 0.5, 0.5}, 0.25));
+        insert_surface(CCylZ(10));
+        insert_surface(PlaneZ(-1));
+        insert_surface(PlaneZ(1));
+
+        VolumeInserter insert_volume(&volume_data_);
+        auto           add_volume
+            = [&insert_volume](std::vector<SurfaceId::size_type> faces,
+                               std::vector<logic_int>             logic) {
+                  VolumeInput input;
+                  for (auto f : faces)
+                  {
+                      input.faces.push_back(SurfaceId{f});
+                  }
+                  input.logic = std::move(logic);
+                  return insert_volume(input);
+              };
+
+        using namespace celeritas::logic;
+        // Infinite along z
+        add_volume({0, 1, 2, 3}, {0, 1, lnot, land, 2, land, 3, lnot, land});
+        // Inside the sphere
+        add_volume({4}, {0, lnot});
+        // Inside the box but outside the sphere
+        add_volume({0, 1, 2, 3, 4, 6, 7},
+                   {0,    1, lnot, land, 2, land, 3,    lnot,
+                    land, 5, land, 6,    lnot, land, 4, land});
+        // Doubly negated: outside the cylinder
+        add_volume({5}, {0, lnot, lnot});
+        // Everywhere
+        add_volume({}, {ltrue});
+        // Union of sphere and cylinder interiors
+        add_volume({4, 5}, {0, lnot, 1, lnot, lor});
+    }
+
+    BoundingBox bbox(VolumeId::size_type vol) const
+    {
+        return grid_.bboxes[VolumeId{vol}];
+    }
+
+    SurfaceData<Ownership::value, MemSpace::host>    surface_data_;
+    VolumeData<Ownership::value, MemSpace::host>     volume_data_;
+    VolumeGridData<Ownership::value, MemSpace::host> grid_;
+};
+
+//---------------------------------------------------------------------------//
+// TESTS
+//---------------------------------------------------------------------------//
+
+TEST_F(VolumeGridBuilderTest, all)
+{
+    {
+        VolumeGridBuilder build_grid(&grid_);
+        SurfaceData<Ownership::const_reference, MemSpace::host> surfaces;
+        VolumeData<Ownership::const_reference, MemSpace::host>  volumes;
+        surfaces = surface_data_;
+        volumes  = volume_data_;
+        build_grid(surfaces, volumes);
+    }
+    ASSERT_TRUE(grid_);
+    ASSERT_EQ(6, grid_.bboxes.size());
+
+    const real_type inf = std::numeric_limits<real_type>::infinity();
+    EXPECT_VEC_SOFT_EQ(Real3({0, 0, -inf}), bbox(0).lower);
+    EXPECT_VEC_SOFT_EQ(Real3({2, 1, inf}), bbox(0).upper);
+    EXPECT_VEC_SOFT_EQ(Real3({0.25, 0.25, 0.25}), bbox(1).lower);
+    EXPECT_VEC_SOFT_EQ(Real3({0.75, 0.75, 0.75}), bbox(1).upper);
+    EXPECT_VEC_SOFT_EQ(Real3({0, 0, -1}), bbox(2).lower);
+    EXPECT_VEC_SOFT_EQ(Real3({2, 1, 1}), bbox(2).upper);
+    EXPECT_VEC_SOFT_EQ(Real3({-inf, -inf, -inf}), bbox(3).lower);
+    EXPECT_VEC_SOFT_EQ(Real3({inf, inf, inf}), bbox(3).upper);
+    EXPECT_VEC_SOFT_EQ(Real3({-inf, -inf, -inf}), bbox(4).lower);
+    EXPECT_VEC_SOFT_EQ(Real3({inf, inf, inf}), bbox(4).upper);
+    EXPECT_VEC_SOFT_EQ(Real3({-10, -10, -inf}), bbox(5).lower);
+    EXPECT_VEC_SOFT_EQ(Real3({10, 10, inf}), bbox(5).upper);
+
+    // Grid covers the two bounded volumes
+    EXPECT_VEC_SOFT_EQ(Real3({0, 0, -1}), grid_.extents.lower);
+    EXPECT_VEC_SOFT_EQ(Real3({2, 1, 1}), grid_.extents.upper);
+    EXPECT_EQ(2, grid_.dims[0]);
+    EXPECT_EQ(1, grid_.dims[1]);
+    EXPECT_EQ(2, grid_.dims[2]);
+    EXPECT_VEC_SOFT_EQ(Real3({1, 1, 1}), grid_.delta);
+    EXPECT_EQ(4, grid_.cells.size());
+
+    VolumeGridData<Ownership::const_reference, MemSpace::host> grid_ref;
+    grid_ref = grid_;
+
+    auto candidates = [&grid_ref](const Real3& pos) {
+        std::vector<int> result;
+        for (VolumeId id : find_candidates(grid_ref, pos))
+        {
+            result.push_back(id.unchecked_get());
+        }
+        return result;
+    };
+
+    {
+        // Cell containing the sphere
+        static const int expected[] = {0, 1, 2, 3, 4, 5};
+        EXPECT_VEC_EQ(expected, candidates({0.5, 0.5, 0.5}));
+    }
+    {
+        // Other cells
+        static const int expected[] = {0, 2, 3, 4, 5};
+        EXPECT_VEC_EQ(expected, candidates({1.5, 0.5, -0.5}));
+        EXPECT_VEC_EQ(expected, candidates({0.5, 0.5, -0.5}));
+        EXPECT_VEC_EQ(expected, candidates({2, 1, 1}));
+    }
+    {
+        // Outside the grid
+        static const int expected[] = {0, 3, 4, 5};
+        EXPECT_VEC_EQ(expected, candidates({0.5, 0.5, 5}));
+        EXPECT_VEC_EQ(expected, candidates({-100, 0, 0}));
+    }
+}
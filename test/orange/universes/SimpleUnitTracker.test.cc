@@ -7,6 +7,7 @@
 //---------------------------------------------------------------------------//
 #include "orange/universes/SimpleUnitTracker.hh"
 
+#include <algorithm>
 #include <random>
 
 // Source includes
@@ -52,6 +53,13 @@ class SimpleUnitTrackerTest : public celeritas_test::OrangeGeoTestBase
         void print_expected() const;
     };
 
+    //! Time per track with and without acceleration structures [s]
+    struct ComparedTime
+    {
+        double accelerated{0};
+        double brute_force{0};
+    };
+
   protected:
     // Initialization without any logical state
     LocalState make_state(Real3 pos, Real3 dir);
@@ -63,6 +71,9 @@ class SimpleUnitTrackerTest : public celeritas_test::OrangeGeoTestBase
     HeuristicInitResult run_heuristic_init_host(size_type num_tracks) const;
     HeuristicInitResult run_heuristic_init_device(size_type num_tracks) const;
 
+    // Compare initialization with and without the volume grid
+    ComparedTime compare_grid_init(size_type num_tracks) const;
+
   private:
     StateHostValue      setup_heuristic_states(size_type num_tracks) const;
     HeuristicInitResult reduce_heuristic_init(StateHostValue, double) const;
@@ -87,6 +98,13 @@ class TwoVolumeTest : public SimpleUnitTrackerTest
     }
 };
 
+class LatticeTest : public SimpleUnitTrackerTest
+{
+  protected:
+    // Compare surface crossing with and without connectivity
+    ComparedTime compare_crossing(size_type lattice_size, size_type num_tracks);
+};
+
 //! Construct a test name that is disabled when JSON is disabled
 #if CELERITAS_USE_JSON
 #    define TEST_IF_CELERITAS_JSON(name) name
@@ -287,6 +305,129 @@ void SimpleUnitTrackerTest::HeuristicInitResult::print_expected() const
          << "/*** END CODE ***/\n";
 }
 
+//---------------------------------------------------------------------------//
+/*!
+ * Compare initialization with and without the volume grid.
+ *
+ * The points are sampled uniformly in the bounding box, and the resulting
+ * volumes must agree.
+ */
+auto SimpleUnitTrackerTest::compare_grid_init(size_type num_tracks) const
+    -> ComparedTime
+{
+    CELER_EXPECT(this->params_host_ref().volume_grid);
+    ParamsHostRef brute_force_params = this->params_host_ref();
+    brute_force_params.volume_grid   = {};
+
+    std::vector<Real3> points(num_tracks);
+    {
+        std::mt19937            rng;
+        UniformBoxDistribution<> sample_box{this->bbox_lower(),
+                                            this->bbox_upper()};
+        for (Real3& pos : points)
+        {
+            pos = sample_box(rng);
+        }
+    }
+
+    std::vector<Sense> senses(this->params_host_ref().scalars.max_faces);
+    auto               initialize_all = [&](const ParamsHostRef& params,
+                                  std::vector<VolumeId>* volumes) {
+        SimpleUnitTracker tracker(params);
+        LocalState        state;
+        state.dir         = {1, 0, 0};
+        state.temp_senses = make_span(senses);
+        volumes->clear();
+
+        Stopwatch get_time;
+        for (const Real3& pos : points)
+        {
+            state.pos = pos;
+            volumes->push_back(tracker.initialize(state).volume);
+        }
+        return get_time() / num_tracks;
+    };
+
+    std::vector<VolumeId> grid_volumes;
+    std::vector<VolumeId> brute_force_volumes;
+    ComparedTime          result;
+    result.accelerated = initialize_all(this->params_host_ref(), &grid_volumes);
+    result.brute_force
+        = initialize_all(brute_force_params, &brute_force_volumes);
+
+    EXPECT_EQ(brute_force_volumes, grid_volumes);
+    EXPECT_EQ(0,
+              std::count(grid_volumes.begin(), grid_volumes.end(), VolumeId{}));
+    return result;
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * Compare surface crossing with and without connectivity.
+ *
+ * Tracks cross the plane in the middle of the lattice along +x at random
+ * points, and the resulting volumes must agree.
+ */
+auto LatticeTest::compare_crossing(size_type lattice_size, size_type num_tracks)
+    -> ComparedTime
+{
+    CELER_EXPECT(this->params_host_ref().connectivity);
+    ParamsHostRef brute_force_params = this->params_host_ref();
+    brute_force_params.volume_grid   = {};
+    brute_force_params.connectivity  = {};
+
+    const size_type   i    = lattice_size / 2;
+    const std::string surf = "px" + std::to_string(i);
+
+    std::vector<LocalState>  states;
+    std::vector<std::string> expected_labels;
+    {
+        std::mt19937                              rng;
+        std::uniform_real_distribution<real_type> sample_coord(0,
+                                                               lattice_size);
+        for (CELER_MAYBE_UNUSED auto n : range(num_tracks))
+        {
+            Real3 pos{static_cast<real_type>(i), 0, 0};
+            pos[1] = sample_coord(rng);
+            pos[2] = sample_coord(rng);
+            std::string jk = "," + std::to_string(static_cast<int>(pos[1]))
+                             + "," + std::to_string(static_cast<int>(pos[2]));
+            std::string vol = std::to_string(i - 1) + jk;
+            states.push_back(this->make_state(
+                pos, {1, 0, 0}, vol.c_str(), surf.c_str(), '-'));
+            expected_labels.push_back(std::to_string(i) + jk);
+        }
+    }
+
+    auto cross_all = [&states](const ParamsHostRef&   params,
+                               std::vector<VolumeId>* volumes) {
+        SimpleUnitTracker tracker(params);
+        volumes->clear();
+
+        Stopwatch get_time;
+        for (const LocalState& state : states)
+        {
+            volumes->push_back(tracker.initialize(state).volume);
+        }
+        return get_time() / states.size();
+    };
+
+    std::vector<VolumeId> volumes;
+    std::vector<VolumeId> brute_force_volumes;
+    ComparedTime          result;
+    result.accelerated = cross_all(this->params_host_ref(), &volumes);
+    result.brute_force = cross_all(brute_force_params, &brute_force_volumes);
+
+    EXPECT_EQ(brute_force_volumes, volumes);
+    std::vector<std::string> labels;
+    for (VolumeId id : volumes)
+    {
+        labels.push_back(this->id_to_label(id));
+    }
+    EXPECT_EQ(expected_labels, labels);
+    return result;
+}
+
 //---------------------------------------------------------------------------//
 // TESTS
 //---------------------------------------------------------------------------//
@@ -531,3 +672,148 @@ TEST_F(FiveVolumesTest, heuristic_init)
         EXPECT_SOFT_EQ(0, result.failed);
     }
 }
+
+// Time the volume grid on a small, irregular geometry
+TEST_F(FiveVolumesTest, DISABLED_performance)
+{
+    auto init_time = this->compare_grid_init(100000);
+    cout << "Initialization time per track with " << this->num_volumes()
+         << " volumes: " << init_time.accelerated * 1e9 << " ns with grid, "
+         << init_time.brute_force * 1e9 << " ns without" << endl;
+}
+
+//---------------------------------------------------------------------------//
+
+TEST_F(LatticeTest, grid)
+{
+    LatticeInput inp;
+    inp.size = 3;
+    this->build_geometry(inp);
+
+    const auto& grid = this->params_host_ref().volume_grid;
+    ASSERT_TRUE(grid);
+    EXPECT_VEC_SOFT_EQ(Real3({0, 0, 0}), grid.extents.lower);
+    EXPECT_VEC_SOFT_EQ(Real3({3, 3, 3}), grid.extents.upper);
+    EXPECT_EQ(3, grid.dims[0]);
+    EXPECT_EQ(3, grid.dims[1]);
+    EXPECT_EQ(3, grid.dims[2]);
+
+    // Only the exterior is outside the grid
+    auto exterior = grid.volumes[grid.exterior];
+    ASSERT_EQ(1, exterior.size());
+    EXPECT_EQ("[EXTERIOR]", this->id_to_label(exterior[0]));
+
+    // Inner planes bound two layers of cubes, outer planes the exterior too
+    const auto& conn = this->params_host_ref().connectivity;
+    ASSERT_TRUE(conn);
+    auto neighbors = [&](const char* surf) {
+        return conn.volumes[conn.neighbors[this->find_surface(surf)]];
+    };
+    EXPECT_EQ(18, neighbors("px2").size());
+    EXPECT_EQ(10, neighbors("pz0").size());
+    EXPECT_EQ("[EXTERIOR]", this->id_to_label(neighbors("pz0")[0]));
+
+    // Each cell holds the exterior and a single cube
+    for (auto cell : grid.cells[AllItems<ItemRange<VolumeId>>{}])
+    {
+        EXPECT_EQ(2, cell.size());
+    }
+
+    SimpleUnitTracker tracker(this->params_host_ref());
+    {
+        SCOPED_TRACE("Inside a cube");
+        auto init = tracker.initialize(
+            this->make_state({1.5, 0.5, 2.25}, {1, 0, 0}));
+        EXPECT_EQ("1,0,2", this->id_to_label(init.volume));
+        EXPECT_FALSE(init.surface);
+    }
+    {
+        SCOPED_TRACE("Crossing between cubes");
+        auto init = tracker.initialize(
+            this->make_state({2, 0.5, 0.5}, {1, 0, 0}, "1,0,0", "px2", '-'));
+        EXPECT_EQ("2,0,0", this->id_to_label(init.volume));
+        EXPECT_EQ("px2", this->id_to_label(init.surface.id()));
+    }
+    {
+        SCOPED_TRACE("Crossing out of the lattice");
+        auto init = tracker.initialize(
+            this->make_state({3, 0.5, 0.5}, {1, 0, 0}, "2,0,0", "px3", '-'));
+        EXPECT_EQ("[EXTERIOR]", this->id_to_label(init.volume));
+    }
+    {
+        SCOPED_TRACE("Crossing into the lattice from outside");
+        auto init = tracker.initialize(this->make_state(
+            {3, 2.5, 2.5}, {-1, 0, 0}, "[EXTERIOR]", "px3", '+'));
+        EXPECT_EQ("2,2,2", this->id_to_label(init.volume));
+    }
+    {
+        SCOPED_TRACE("Outside the grid");
+        auto init
+            = tracker.initialize(this->make_state({-5, 10, 1}, {1, 0, 0}));
+        EXPECT_EQ("[EXTERIOR]", this->id_to_label(init.volume));
+    }
+}
+
+TEST_F(LatticeTest, crossing_fallback)
+{
+    LatticeInput inp;
+    inp.size = 3;
+    this->build_geometry(inp);
+
+    // The point is in none of the volumes bounded by the crossed surface
+    // (e.g. the crossing was reported with roundoff error), so all volumes
+    // are searched instead
+    const LocalState state = this->make_state(
+        {2, -0.5, 0.5}, {1, 0, 0}, "1,0,0", "px2", '-');
+    {
+        SCOPED_TRACE("With volume grid");
+        SimpleUnitTracker tracker(this->params_host_ref());
+        auto              init = tracker.initialize(state);
+        EXPECT_EQ("[EXTERIOR]", this->id_to_label(init.volume));
+        EXPECT_FALSE(init.surface);
+    }
+    {
+        SCOPED_TRACE("Without volume grid");
+        ParamsHostRef params = this->params_host_ref();
+        params.volume_grid   = {};
+        SimpleUnitTracker tracker(params);
+        auto              init = tracker.initialize(state);
+        EXPECT_EQ("[EXTERIOR]", this->id_to_label(init.volume));
+        EXPECT_FALSE(init.surface);
+    }
+}
+
+TEST_F(LatticeTest, heuristic_init)
+{
+    LatticeInput inp;
+    inp.size = 4;
+    this->build_geometry(inp);
+    this->compare_grid_init(1000);
+}
+
+TEST_F(LatticeTest, crossing)
+{
+    LatticeInput inp;
+    inp.size = 4;
+    this->build_geometry(inp);
+    this->compare_crossing(inp.size, 100);
+}
+
+// Time the acceleration structures on a large lattice
+TEST_F(LatticeTest, DISABLED_performance)
+{
+    LatticeInput inp;
+    inp.size = 16;
+    this->build_geometry(inp);
+
+    auto init_time = this->compare_grid_init(1000);
+    cout << "Initialization time per track with " << this->num_volumes()
+         << " volumes: " << init_time.accelerated * 1e9 << " ns with grid, "
+         << init_time.brute_force * 1e9 << " ns without" << endl;
+
+    auto cross_time = this->compare_crossing(inp.size, 1000);
+    cout << "Crossing time per track with " << this->num_volumes()
+         << " volumes: " << cross_time.accelerated * 1e9
+         << " ns with connectivity, " << cross_time.brute_force * 1e9
+         << " ns without" << endl;
+}
@@ -8,10 +8,17 @@
 #include "physics/base/PhysicsParams.hh"
 #include "physics/base/PhysicsTrackView.hh"
 
+#include <atomic>
+#include <cstdio>
+#include <fstream>
 #include "celeritas_test.hh"
 #include "base/Range.hh"
 #include "base/CollectionStateStore.hh"
+#include "physics/base/CutoffParams.hh"
+#include "physics/base/ImportedProcessAdapter.hh"
+#include "physics/base/ModelFinder.hh"
 #include "physics/base/ParticleParams.hh"
+#include "physics/material/MaterialParams.hh"
 #include "physics/grid/RangeCalculator.hh"
 #include "physics/grid/XsCalculator.hh"
 #include "physics/em/EPlusAnnihilationProcess.hh"
@@ -31,6 +38,38 @@ class PhysicsParamsTest : public PhysicsTestBase
 {
 };
 
+//---------------------------------------------------------------------------//
+//! Process wrapper that counts the calls to build step limit tables
+class CountingProcess final : public Process
+{
+  public:
+    using SPConstProcess = std::shared_ptr<const Process>;
+    using SPCount        = std::shared_ptr<std::atomic<int>>;
+
+    CountingProcess(SPConstProcess process, SPCount count)
+        : process_(std::move(process)), count_(std::move(count))
+    {
+    }
+
+    VecModel build_models(ModelIdGenerator next_id) const final
+    {
+        return process_->build_models(next_id);
+    }
+
+    StepLimitBuilders step_limits(Applicability range) const final
+    {
+        ++*count_;
+        return process_->step_limits(range);
+    }
+
+    ProcessType type() const final { return process_->type(); }
+    std::string label() const final { return process_->label(); }
+
+  private:
+    SPConstProcess process_;
+    SPCount        count_;
+};
+
 TEST_F(PhysicsParamsTest, accessors)
 {
     const PhysicsParams& p = *this->physics();
@@ -91,6 +130,202 @@ TEST_F(PhysicsParamsTest, accessors)
     EXPECT_VEC_EQ(expected_process_map, process_map);
 }
 
+TEST_F(PhysicsParamsTest, cache)
+{
+    const PhysicsParams::HostRef& expected = this->physics()->host_ref();
+
+    // Production cuts and imported tables are part of the cache key
+    auto make_cutoffs = [this](real_type range) {
+        CutoffParams::Input cut_inp;
+        cut_inp.particles = this->particles();
+        cut_inp.materials = this->materials();
+        cut_inp.cutoffs[pdg::electron()]
+            = {{MevEnergy{0.1}, 0.01}, {MevEnergy{0.2}, 0.02}, {{}, range}};
+        return std::make_shared<CutoffParams>(cut_inp);
+    };
+    auto make_imported = [](double xs) {
+        ImportPhysicsVector vec;
+        vec.vector_type = ImportPhysicsVectorType::log;
+        vec.x           = {1e-3, 1e-2, 1e-1};
+        vec.y           = {xs, xs, xs};
+
+        ImportPhysicsTable table;
+        table.table_type      = ImportTableType::lambda;
+        table.x_units         = ImportUnits::mev;
+        table.y_units         = ImportUnits::cm_inv;
+        table.physics_vectors = {vec};
+
+        ImportProcess proc;
+        proc.particle_pdg  = pdg::gamma().get();
+        proc.process_type  = ImportProcessType::electromagnetic;
+        proc.process_class = ImportProcessClass::compton;
+        proc.models        = {ImportModelClass::klein_nishina};
+        proc.tables        = {table};
+        return std::make_shared<ImportedProcesses>(
+            std::vector<ImportProcess>{proc});
+    };
+
+    // Count the step limit tables built by the processes
+    auto count       = std::make_shared<std::atomic<int>>(0);
+    auto build_input = [&] {
+        PhysicsInput result = this->build_physics_input();
+        for (auto& process : result.processes)
+        {
+            process = std::make_shared<CountingProcess>(process, count);
+        }
+        result.cutoffs  = make_cutoffs(0);
+        result.imported = make_imported(1.0);
+        return result;
+    };
+    auto num_built = [&count] { return count->exchange(0); };
+
+    PhysicsInput inp = build_input();
+    inp.cache_file   = this->make_unique_filename(".bin");
+    // Remove a cache left behind by an earlier failed run
+    std::remove(inp.cache_file.c_str());
+
+    auto expect_same_tables = [&expected](const PhysicsParams& p) {
+        const PhysicsParams::HostRef& actual = p.host_ref();
+        EXPECT_VEC_EQ(expected.reals[AllItems<real_type>{}],
+                      actual.reals[AllItems<real_type>{}]);
+        EXPECT_VEC_EQ(expected.grid_values[AllItems<table_real_type>{}],
+                      actual.grid_values[AllItems<table_real_type>{}]);
+        ASSERT_EQ(expected.value_grids.size(), actual.value_grids.size());
+        for (auto grid_id : range(ValueGridId{expected.value_grids.size()}))
+        {
+            const auto& expected_value = expected.value_grids[grid_id].value;
+            const auto& actual_value   = actual.value_grids[grid_id].value;
+            EXPECT_EQ(expected_value.begin()->get(),
+                      actual_value.begin()->get());
+            EXPECT_EQ(expected_value.size(), actual_value.size());
+        }
+        EXPECT_EQ(expected.value_tables.size(), actual.value_tables.size());
+        EXPECT_EQ(expected.process_groups.size(),
+                  actual.process_groups.size());
+        EXPECT_VEC_EQ(expected.model_indices[AllItems<size_type>{}],
+                      actual.model_indices[AllItems<size_type>{}]);
+
+        // Look up models with the loaded data and compare against a search
+        // of the model bounds
+        ASSERT_EQ(expected.model_groups.size(), actual.model_groups.size());
+        int num_lookups = 0;
+        for (auto id : range(ItemId<ModelGroup>{actual.model_groups.size()}))
+        {
+            const ModelGroup& md = actual.model_groups[id];
+            EXPECT_EQ(expected.model_groups[id].lookup_model.size(),
+                      md.lookup_model.size());
+            if (!md.lookup_grid)
+                continue;
+
+            Span<const real_type> bounds = actual.reals[md.energy];
+            Span<const ModelId>   models = actual.model_ids[md.model];
+            ModelFinder           find_model(bounds,
+                                   models,
+                                   md.lookup_grid,
+                                   actual.model_indices[md.lookup_model]);
+            ModelFinder           search_model(bounds, models, {}, {});
+            for (real_type energy : bounds)
+            {
+                EXPECT_EQ(search_model(MevEnergy{energy}),
+                          find_model(MevEnergy{energy}))
+                    << "at " << energy;
+                ++num_lookups;
+            }
+        }
+        EXPECT_LT(0, num_lookups);
+    };
+
+    {
+        SCOPED_TRACE("Require the cache key inputs");
+        PhysicsInput other_inp = build_input();
+        other_inp.cache_file   = inp.cache_file;
+        other_inp.cutoffs      = nullptr;
+        EXPECT_THROW(PhysicsParams{other_inp}, RuntimeError);
+        other_inp.cutoffs  = inp.cutoffs;
+        other_inp.imported = nullptr;
+        EXPECT_THROW(PhysicsParams{other_inp}, RuntimeError);
+        EXPECT_EQ(0, num_built());
+    }
+    {
+        SCOPED_TRACE("Build and write cache");
+        expect_same_tables(PhysicsParams(inp));
+        EXPECT_LT(0, num_built());
+    }
+    {
+        SCOPED_TRACE("Load from cache");
+        expect_same_tables(PhysicsParams(inp));
+        EXPECT_EQ(0, num_built());
+    }
+    {
+        SCOPED_TRACE("Load from cache with equivalent materials");
+        PhysicsInput other_inp = build_input();
+        other_inp.cache_file   = inp.cache_file;
+        other_inp.materials    = this->build_materials();
+        expect_same_tables(PhysicsParams(other_inp));
+        EXPECT_EQ(0, num_built());
+    }
+    {
+        SCOPED_TRACE("Rebuild with different options");
+        PhysicsInput other_inp            = build_input();
+        other_inp.cache_file              = inp.cache_file;
+        other_inp.options.use_integral_xs = !inp.options.use_integral_xs;
+        PhysicsParams p(other_inp);
+        EXPECT_LT(0, num_built());
+        // Max xs envelopes are only built for the integral approach
+        EXPECT_GT(expected.value_grids.size(),
+                  p.host_ref().value_grids.size());
+        for (const IntegralXsProcess& process :
+             p.host_ref().integral_xs[AllItems<IntegralXsProcess>{}])
+        {
+            EXPECT_FALSE(process);
+        }
+    }
+    {
+        SCOPED_TRACE("Rebuild with different materials");
+        MaterialParams::Input mat_inp;
+        mat_inp.elements = {{1, units::AmuMass{1.0}, "celerogen"}};
+        for (real_type temperature : {300, 300, 400})
+        {
+            mat_inp.materials.push_back({1e20,
+                                         temperature,
+                                         MatterState::gas,
+                                         {{ElementId{0}, 1.0}},
+                                         "celerogen"});
+        }
+        PhysicsInput other_inp = build_input();
+        other_inp.cache_file   = inp.cache_file;
+        other_inp.materials
+            = std::make_shared<MaterialParams>(std::move(mat_inp));
+        PhysicsParams p(other_inp);
+        EXPECT_LT(0, num_built());
+    }
+    {
+        SCOPED_TRACE("Rebuild with different cutoffs");
+        inp.cutoffs = make_cutoffs(0.03);
+        expect_same_tables(PhysicsParams(inp));
+        EXPECT_LT(0, num_built());
+        inp.cutoffs = make_cutoffs(0.03);
+        expect_same_tables(PhysicsParams(inp));
+        EXPECT_EQ(0, num_built());
+    }
+    {
+        SCOPED_TRACE("Rebuild with different imported tables");
+        inp.imported = make_imported(2.0);
+        expect_same_tables(PhysicsParams(inp));
+        EXPECT_LT(0, num_built());
+        inp.imported = make_imported(2.0);
+        expect_same_tables(PhysicsParams(inp));
+        EXPECT_EQ(0, num_built());
+    }
+    {
+        SCOPED_TRACE("Rebuild from truncated cache");
+        std::ofstream(inp.cache_file, std::ios::binary) << "CELP";
+        expect_same_tables(PhysicsParams(inp));
+        EXPECT_LT(0, num_built());
+    }
+    std::remove(inp.cache_file.c_str());
+}
+
 //---------------------------------------------------------------------------//
 // PHYSICS TRACK VIEW (HOST)
 //---------------------------------------------------------------------------//
@@ -255,17 +490,19 @@ TEST_F(PhysicsTrackViewHostTest, value_grids)
         }
     }
 
-    // Grid IDs should be unique if they exist. Gammas should have fewer
-    // because there aren't any slowing down/range limiters.
+    // Grid IDs should be unique if they exist, except for identical grids:
+    // "meows" has the same cross sections for celeritons and
+    // anti-celeritons. Gammas should have fewer because there aren't any
+    // slowing down/range limiters.
     const int expected_grid_ids[]
         = {0,  -1, -1, 3,  -1, -1, 1,  -1, -1, 4,  -1, -1, 2,  -1, -1, 5,
            -1, -1, 6,  -1, -1, 9,  10, 11, 18, -1, -1, 7,  -1, -1, 12, 13,
            14, 19, -1, -1, 8,  -1, -1, 15, 16, 17, 20, -1, -1, 21, 22, 23,
-           30, -1, -1, 24, 25, 26, 31, -1, -1, 27, 28, 29, 32, -1, -1};
+           18, -1, -1, 24, 25, 26, 19, -1, -1, 27, 28, 29, 20, -1, -1};
     EXPECT_VEC_EQ(expected_grid_ids, grid_ids);
 }
 
-TEST_F(PhysicsTrackViewHostTest, calc_xs)
+TEST_F(PhysicsTrackViewHostTest, TEST_IF_CELERITAS_DOUBLE_TABLES(calc_xs))
 {
     // Cross sections: same across particle types, constant in energy, scale
     // according to material number density
@@ -288,7 +525,7 @@ TEST_F(PhysicsTrackViewHostTest, calc_xs)
     EXPECT_VEC_SOFT_EQ(expected_xs, xs);
 }
 
-TEST_F(PhysicsTrackViewHostTest, calc_range)
+TEST_F(PhysicsTrackViewHostTest, TEST_IF_CELERITAS_DOUBLE_TABLES(calc_range))
 {
     // Default range and scaling
     EXPECT_SOFT_EQ(0.1 * units::centimeter, params_ref.scaling_min_range);
@@ -334,7 +571,7 @@ TEST_F(PhysicsTrackViewHostTest, calc_range)
     EXPECT_VEC_SOFT_EQ(expected_step, step);
 }
 
-TEST_F(PhysicsTrackViewHostTest, use_integral)
+TEST_F(PhysicsTrackViewHostTest, TEST_IF_CELERITAS_DOUBLE_TABLES(use_integral))
 {
     {
         // No energy loss tables
@@ -343,6 +580,7 @@ TEST_F(PhysicsTrackViewHostTest, use_integral)
         auto ppid = this->find_ppid(phys, "scattering");
         ASSERT_TRUE(ppid);
         EXPECT_FALSE(phys.use_integral_xs(ppid));
+        EXPECT_FALSE(phys.max_xs_grid(ppid));
         auto id = phys.value_grid(ValueGridType::macro_xs, ppid);
         ASSERT_TRUE(id);
         EXPECT_SOFT_EQ(0.1, phys.calc_xs(ppid, id, MevEnergy{1.0}));
@@ -356,14 +594,17 @@ TEST_F(PhysicsTrackViewHostTest, use_integral)
         ASSERT_TRUE(ppid);
         EXPECT_TRUE(phys.use_integral_xs(ppid));
         EXPECT_SOFT_EQ(0.8, phys.energy_fraction());
-        EXPECT_SOFT_EQ(0.1, phys.energy_max_xs(ppid));
+        EXPECT_TRUE(phys.max_xs_grid(ppid));
         auto id = phys.value_grid(ValueGridType::macro_xs, ppid);
         ASSERT_TRUE(id);
         for (real_type energy : {0.001, 0.01, 0.1, 0.11, 10.0})
         {
             xs.push_back(phys.calc_xs(ppid, id, MevEnergy{energy}));
         }
-        const double expected_xs[] = {0.6, 36. / 55, 1.2, 1.2, 357. / 495};
+        // The envelope bounds the largest cross section over the step
+        // (0.6, 36/55, 1.2, 1.2, 357/495) and is flat near the peak
+        const double expected_xs[] = {
+            0.60070232722732, 0.661568726818651, 1.2, 1.2, 0.771563392995586};
         EXPECT_VEC_SOFT_EQ(expected_xs, xs);
     }
 }
@@ -416,9 +657,32 @@ TEST_F(PhysicsTrackViewHostTest, model_finder)
     EXPECT_EQ(4, find_model(MevEnergy{5}).unchecked_get());
     EXPECT_EQ(5, find_model(MevEnergy{50}).unchecked_get());
     EXPECT_FALSE(find_model(MevEnergy{100.1}));
+
+    // Bounds are attached to the model above, except for the last
+    EXPECT_EQ(3, find_model(MevEnergy{1e-3}).unchecked_get());
+    EXPECT_EQ(4, find_model(MevEnergy{1}).unchecked_get());
+    EXPECT_EQ(5, find_model(MevEnergy{10}).unchecked_get());
+    EXPECT_EQ(5, find_model(MevEnergy{100}).unchecked_get());
+
+    // Direct lookup with and without a cached location matches the bounds
+    const real_type bounds[] = {1e-3, 1, 10, 100};
+    for (real_type energy = 1e-3; energy < 100; energy *= 1.01)
+    {
+        unsigned int expected = 3;
+        while (expected < 5 && energy >= bounds[expected - 2])
+        {
+            ++expected;
+        }
+        EnergyLookupCache lookup(MevEnergy{energy});
+        EXPECT_EQ(expected, find_model(MevEnergy{energy}).unchecked_get())
+            << "at " << energy;
+        EXPECT_EQ(expected, find_model(lookup).unchecked_get())
+            << "at " << energy;
+    }
 }
 
-TEST_F(PhysicsTrackViewHostTest, cuda_surrogate)
+TEST_F(PhysicsTrackViewHostTest,
+       TEST_IF_CELERITAS_DOUBLE_TABLES(cuda_surrogate))
 {
     std::vector<real_type> step;
     for (const char* particle : {"gamma", "anti-celeriton"})
@@ -12,6 +12,7 @@
 #include "physics/base/CutoffParams.hh"
 #include "physics/base/ParticleParams.hh"
 #include "physics/base/PhysicsParams.hh"
+#include "physics/grid/XsCalculator.hh"
 #include "celeritas_test.hh"
 #include "PhysicsTestBase.hh"
 
@@ -97,7 +98,8 @@ class PhysicsStepUtilsTest : public PhysicsTestBase
 // TESTS
 //---------------------------------------------------------------------------//
 
-TEST_F(PhysicsStepUtilsTest, calc_tabulated_physics_step)
+TEST_F(PhysicsStepUtilsTest,
+       TEST_IF_CELERITAS_DOUBLE_TABLES(calc_tabulated_physics_step))
 {
     MaterialTrackView material(
         this->materials()->host_ref(), mat_state.ref(), ThreadId{0});
@@ -161,7 +163,7 @@ TEST_F(PhysicsStepUtilsTest, calc_tabulated_physics_step)
     }
 }
 
-TEST_F(PhysicsStepUtilsTest, calc_energy_loss)
+TEST_F(PhysicsStepUtilsTest, TEST_IF_CELERITAS_DOUBLE_TABLES(calc_energy_loss))
 {
     MaterialTrackView material(
         this->materials()->host_ref(), mat_state.ref(), ThreadId{0});
@@ -178,6 +180,9 @@ TEST_F(PhysicsStepUtilsTest, calc_energy_loss)
         // Long step, but gamma means no energy loss
         PhysicsTrackView phys = this->init_track(
             &material, MaterialId{0}, &particle, "gamma", MevEnergy{1});
+        phys.interaction_mfp(1);
+        celeritas::calc_tabulated_physics_step(material, particle, phys);
+        EXPECT_SOFT_EQ(0, phys.eloss_rate());
         EXPECT_SOFT_EQ(0,
                        celeritas::calc_energy_loss(
                            cutoffs, material, particle, phys, 1e4, this->rng())
@@ -188,6 +193,13 @@ TEST_F(PhysicsStepUtilsTest, calc_energy_loss)
             &material, MaterialId{0}, &particle, "celeriton", MevEnergy{10});
         const real_type eloss_rate = 0.2 + 0.4;
 
+        // Pre-step loss rate and range are saved with the step limits
+        phys.interaction_mfp(1);
+        celeritas::calc_tabulated_physics_step(material, particle, phys);
+        EXPECT_SOFT_EQ(eloss_rate, phys.eloss_rate());
+        EXPECT_SOFT_EQ(particle.energy().value() / eloss_rate,
+                       phys.eloss_range());
+
         // Tiny step: should still be linear loss (single process)
         EXPECT_SOFT_EQ(eloss_rate * 1e-6,
                        celeritas::calc_energy_loss(
@@ -216,6 +228,9 @@ TEST_F(PhysicsStepUtilsTest, calc_energy_loss)
         PhysicsTrackView phys = this->init_track(
             &material, MaterialId{0}, &particle, "electron", MevEnergy{1e-3});
         const real_type eloss_rate = 0.5;
+        phys.interaction_mfp(1);
+        celeritas::calc_tabulated_physics_step(material, particle, phys);
+        EXPECT_SOFT_EQ(eloss_rate, phys.eloss_rate());
 
         // Low energy particle which loses all its energy over the step will
         // call inverse lookup. Remaining range will be zero and eloss will be
@@ -228,7 +243,8 @@ TEST_F(PhysicsStepUtilsTest, calc_energy_loss)
     }
 }
 
-TEST_F(PhysicsStepUtilsTest, select_process_and_model)
+TEST_F(PhysicsStepUtilsTest,
+       TEST_IF_CELERITAS_DOUBLE_TABLES(select_process_and_model))
 {
     MaterialTrackView material(
         this->materials()->host_ref(), mat_state.ref(), ThreadId{0});
@@ -347,7 +363,133 @@ TEST_F(PhysicsStepUtilsTest, select_process_and_model)
             acceptance_rate.push_back(real_type(count) / num_samples);
         }
         const real_type expected_acceptance_rate[]
-            = {0.9204, 0.9999, 0.4972, 1};
+            = {0.9105, 0.9887, 0.4972, 0.9392};
         EXPECT_VEC_EQ(expected_acceptance_rate, acceptance_rate);
     }
 }
+
+//---------------------------------------------------------------------------//
+
+class TotalXsPhysicsStepUtilsTest : public PhysicsStepUtilsTest
+{
+    PhysicsOptions build_physics_options() const override
+    {
+        PhysicsOptions opts;
+        opts.total_xs_table = true;
+        return opts;
+    }
+};
+
+TEST_F(TotalXsPhysicsStepUtilsTest,
+       TEST_IF_CELERITAS_DOUBLE_TABLES(calc_tabulated_physics_step))
+{
+    MaterialTrackView material(
+        this->materials()->host_ref(), mat_state.ref(), ThreadId{0});
+    ParticleTrackView particle(
+        this->particles()->host_ref(), par_state.ref(), ThreadId{0});
+
+    // Constant cross sections are tabulated exactly
+    {
+        PhysicsTrackView phys = this->init_track(
+            &material, MaterialId{0}, &particle, "gamma", MevEnergy{1});
+        EXPECT_TRUE(phys.total_xs_grid());
+        phys.interaction_mfp(1);
+        real_type step
+            = celeritas::calc_tabulated_physics_step(material, particle, phys);
+        EXPECT_SOFT_EQ(1. / 3.e-4, step);
+        EXPECT_SOFT_EQ(1, phys.macro_xs_energy().value());
+    }
+    {
+        PhysicsTrackView phys = this->init_track(
+            &material, MaterialId{1}, &particle, "celeriton", MevEnergy{10});
+        phys.interaction_mfp(1e-4);
+        real_type step
+            = celeritas::calc_tabulated_physics_step(material, particle, phys);
+        EXPECT_SOFT_EQ(1.e-4 / 9.e-3, step);
+    }
+    {
+        PhysicsTrackView phys = this->init_track(&material,
+                                                 MaterialId{2},
+                                                 &particle,
+                                                 "anti-celeriton",
+                                                 MevEnergy{1e-2});
+        phys.interaction_mfp(1e-6);
+        real_type step
+            = celeritas::calc_tabulated_physics_step(material, particle, phys);
+        EXPECT_SOFT_EQ(1.e-6 / 9.e-1, step);
+    }
+
+    // The energy-dependent cross section is bounded from above, and exact
+    // far below the tabulated energy range
+    for (real_type energy : {1e-6, 1e-4, 1e-3, 2e-2, 0.1, 0.33, 9.9, 20., 1e4})
+    {
+        PhysicsTrackView phys = this->init_track(
+            &material, MaterialId{0}, &particle, "electron", MevEnergy{energy});
+        phys.interaction_mfp(1);
+        celeritas::calc_tabulated_physics_step(material, particle, phys);
+
+        ParticleProcessId ppid{0};
+        auto grid_id = phys.value_grid(ValueGridType::macro_xs, ppid);
+        ASSERT_TRUE(grid_id);
+        real_type xs = phys.calc_xs(ppid, grid_id, particle.energy());
+        if (energy < 1e-5)
+        {
+            EXPECT_SOFT_EQ(xs, phys.macro_xs()) << "at E=" << energy;
+        }
+        else
+        {
+            EXPECT_LE(xs, phys.macro_xs()) << "at E=" << energy;
+        }
+    }
+}
+
+TEST_F(TotalXsPhysicsStepUtilsTest, select_process_and_model)
+{
+    MaterialTrackView material(
+        this->materials()->host_ref(), mat_state.ref(), ThreadId{0});
+    ParticleTrackView particle(
+        this->particles()->host_ref(), par_state.ref(), ThreadId{0});
+
+    {
+        // Exact total: a process is always selected
+        PhysicsTrackView phys = this->init_track(
+            &material, MaterialId{1}, &particle, "celeriton", MevEnergy{10});
+        std::vector<unsigned int> counts(phys.num_particle_processes());
+        for (CELER_MAYBE_UNUSED auto i : range(1000))
+        {
+            phys.interaction_mfp(1);
+            celeritas::calc_tabulated_physics_step(material, particle, phys);
+            phys.interaction_mfp(0);
+            auto result = select_process_and_model(particle, phys, this->rng());
+            ASSERT_TRUE(result);
+            ++counts[result.ppid.get()];
+        }
+        // Cross sections are 1, 3, and 5 barns
+        const unsigned int expected_counts[] = {117, 336, 547};
+        EXPECT_VEC_EQ(expected_counts, counts);
+    }
+    {
+        // Upper bound: null interactions make up the difference
+        PhysicsTrackView phys = this->init_track(
+            &material, MaterialId{0}, &particle, "electron", MevEnergy{0.33});
+        ParticleProcessId ppid{0};
+        auto grid_id = phys.value_grid(ValueGridType::macro_xs, ppid);
+        auto calc_xs = phys.make_calculator<XsCalculator>(grid_id);
+        real_type xs = calc_xs(particle.energy());
+
+        unsigned int num_samples = 10000;
+        unsigned int count       = 0;
+        real_type    total_xs    = 0;
+        for (CELER_MAYBE_UNUSED auto i : range(num_samples))
+        {
+            phys.interaction_mfp(1);
+            celeritas::calc_tabulated_physics_step(material, particle, phys);
+            total_xs = phys.macro_xs();
+            phys.interaction_mfp(0);
+            if (select_process_and_model(particle, phys, this->rng()))
+                ++count;
+        }
+        EXPECT_LT(xs, total_xs);
+        EXPECT_SOFT_NEAR(xs / total_xs, real_type(count) / num_samples, 0.01);
+    }
+}
@@ -114,7 +114,7 @@ class BetheHeitlerInteractorTest : public celeritas_test::InteractorHostTestBase
     }
 
   protected:
-    celeritas::detail::BetheHeitlerData data_;
+    celeritas::detail::BetheHeitlerHostRef data_;
 };
 
 //---------------------------------------------------------------------------//
@@ -140,8 +140,8 @@ TEST_F(ImportedProcessesTest, eplus_annihilation)
 TEST_F(ImportedProcessesTest, gamma_conversion)
 {
     // Create gamma conversion process
-    auto process
-        = std::make_shared<GammaConversionProcess>(particles_, processes_);
+    auto process = std::make_shared<GammaConversionProcess>(
+        particles_, materials_, processes_);
 
     // Test model
     auto models = process->build_models(ModelIdGenerator{});
@@ -556,6 +556,53 @@ TEST_F(LivermorePETest, macro_xs)
     EXPECT_VEC_SOFT_EQ(expected_macro_xs, macro_xs);
 }
 
+TEST_F(LivermorePETest, macro_xs_table)
+{
+    using celeritas::units::MevEnergy;
+
+    std::string       data_path = this->test_data_path("physics/em", "");
+    LivermorePEReader read_element_data(data_path.c_str());
+    LivermorePEModel  tabulated(ModelId{0},
+                               *this->particle_params(),
+                               *this->material_params(),
+                               read_element_data,
+                               false,
+                               true);
+    ASSERT_TRUE(tabulated.host_ref().macro_xs);
+
+    auto material = this->material_track().material_view();
+    LivermorePEMacroXsCalculator calc_exact(model_->host_ref(), material);
+    LivermorePEMacroXsCalculator calc_tabulated(tabulated.host_ref(),
+                                                material);
+
+    // Interpolated cross sections are close to the exact ones, including
+    // across the absorption edges, and identical outside the table
+    for (double e = 1e-6; e < 10; e *= 1.003)
+    {
+        const double exact = calc_exact(MevEnergy{e});
+        if (e < 1e-3 || e > 1)
+        {
+            EXPECT_EQ(exact, calc_tabulated(MevEnergy{e})) << "at " << e;
+        }
+        else
+        {
+            EXPECT_SOFT_NEAR(exact, calc_tabulated(MevEnergy{e}), 1e-3)
+                << "at " << e;
+        }
+    }
+
+    // Bins containing the K edge are calculated exactly
+    const auto&  xs_data = tabulated.host_ref().xs;
+    const double k_edge
+        = xs_data.shells[xs_data.elements[ElementId{0}].shells]
+              .front()
+              .binding_energy.value();
+    for (double e : {k_edge * (1 - 1e-6), k_edge, k_edge * (1 + 1e-6)})
+    {
+        EXPECT_EQ(calc_exact(MevEnergy{e}), calc_tabulated(MevEnergy{e}));
+    }
+}
+
 TEST_F(LivermorePETest, utils)
 {
     using celeritas::AtomicRelaxElement;
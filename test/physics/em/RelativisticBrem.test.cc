@@ -167,16 +167,16 @@ TEST_F(RelativisticBremTest, dxsec)
                                          3.48017265095914,
                                          3.41228707307214};
 
-    const double expected_dxsec[] = {3.55000253342095,
-                                     3.54986051043622,
-                                     3.54943449138746,
-                                     3.54872462599092,
-                                     3.54730551901548,
-                                     3.54305318862896,
-                                     3.53598260644102,
-                                     3.52190382370326,
-                                     3.48016652710843,
-                                     3.41226786120072};
+    const double expected_dxsec[] = {3.55000253350764,
+                                     3.54986051060961,
+                                     3.54943449182093,
+                                     3.54872462685784,
+                                     3.54730552074929,
+                                     3.54305319296313,
+                                     3.53598261510828,
+                                     3.5219038410337,
+                                     3.48016657040984,
+                                     3.41226794777122};
 
     EXPECT_VEC_SOFT_EQ(expected_dxsec_lpm, dxsec_value_lpm);
     EXPECT_VEC_SOFT_EQ(expected_dxsec, dxsec_value);
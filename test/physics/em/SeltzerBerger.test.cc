@@ -7,6 +7,7 @@
 //---------------------------------------------------------------------------//
 #include "physics/em/detail/SeltzerBergerInteractor.hh"
 #include "physics/em/detail/SBPositronXsCorrector.hh"
+#include "physics/em/detail/SBCdfEnergyDistribution.hh"
 #include "physics/em/detail/SBEnergyDistribution.hh"
 #include "physics/em/SeltzerBergerModel.hh"
 
@@ -30,6 +31,7 @@ using celeritas::ElementId;
 using celeritas::ElementView;
 using celeritas::SeltzerBergerModel;
 using celeritas::SeltzerBergerReader;
+using celeritas::detail::SBCdfEnergyDistribution;
 using celeritas::detail::SBElectronXsCorrector;
 using celeritas::detail::SBEnergyDistHelper;
 using celeritas::detail::SBEnergyDistribution;
@@ -298,6 +300,114 @@ TEST_F(SeltzerBergerTest, sb_energy_dist)
     EXPECT_VEC_SOFT_EQ(expected_avg_engine_samples, avg_engine_samples);
 }
 
+TEST_F(SeltzerBergerTest, sb_cdf_energy_dist)
+{
+    // Construct the model with sampling tables
+    SeltzerBergerReader read_element_data(
+        this->test_data_path("physics/em", "").c_str());
+    SeltzerBergerModel model(ModelId{0},
+                             *this->particle_params(),
+                             *this->material_params(),
+                             read_element_data,
+                             true);
+    const auto& xs = model.host_ref().differential_xs;
+    {
+        const auto& el = xs.elements[ElementId{0}];
+        EXPECT_FALSE(model_->host_ref()
+                         .differential_xs.elements[ElementId{0}]
+                         .has_cdf());
+        EXPECT_TRUE(el.has_cdf());
+        EXPECT_EQ(el.grid.values.size(), el.cdf.size());
+        EXPECT_EQ(el.grid.values.size(), el.envelope.size());
+    }
+
+    const ParticleParams& pp = *this->particle_params();
+    const MevMass   positron_mass = pp.get(pp.find(pdg::positron())).mass();
+    const MevEnergy gamma_cutoff{0.0009};
+    const int       num_samples = 16384;
+    const int       num_bins    = 8;
+    std::vector<double> avg_engine_samples;
+
+    // Histogram the log of the exiting energy fraction above the cutoff
+    auto sample_many = [&](real_type inc_energy, auto& sample_energy) {
+        const real_type log_min = std::log(gamma_cutoff.value() / inc_energy);
+        std::vector<double> hist(num_bins);
+        RandomEngine&       rng_engine = this->rng();
+        rng_engine.reset_count();
+        for (int i = 0; i < num_samples; ++i)
+        {
+            Energy exit_gamma = sample_energy(rng_engine);
+            EXPECT_GT(exit_gamma.value(), gamma_cutoff.value());
+            EXPECT_LE(exit_gamma.value(), inc_energy);
+            real_type frac = std::log(exit_gamma.value() / inc_energy)
+                             / log_min;
+            int bin = celeritas::min<int>(num_bins - 1, (1 - frac) * num_bins);
+            hist[bin] += 1.0 / num_samples;
+        }
+        avg_engine_samples.push_back(double(rng_engine.count()) / num_samples);
+        return hist;
+    };
+
+    // Bin fractions should agree to within statistical noise
+    auto expect_hist_near = [](const std::vector<double>& expected,
+                               const std::vector<double>& actual) {
+        ASSERT_EQ(expected.size(), actual.size());
+        for (auto i : celeritas::range(expected.size()))
+        {
+            EXPECT_NEAR(expected[i], actual[i], 0.02) << "in bin " << i;
+        }
+    };
+
+    for (real_type inc_energy : {0.001, 0.0045, 0.567, 7.89, 89.0, 901.})
+    {
+        SCOPED_TRACE("Incident energy: " + std::to_string(inc_energy));
+        const Energy   e{inc_energy};
+        const EnergySq dens_corr = this->density_correction(MaterialId{0}, e);
+        SBEnergyDistHelper helper(xs, e, ElementId{0}, dens_corr, gamma_cutoff);
+
+        // Electron: rejection and tabulated sampling
+        SBEnergyDistribution<SBElectronXsCorrector> sample_reject(helper, {});
+        SBCdfEnergyDistribution<SBElectronXsCorrector> sample_cdf(
+            xs, e, ElementId{0}, dens_corr, gamma_cutoff, {});
+        auto expected = sample_many(inc_energy, sample_reject);
+        auto actual   = sample_many(inc_energy, sample_cdf);
+        expect_hist_near(expected, actual);
+
+        if (inc_energy < 0.01)
+        {
+            // The rejection sampler evaluates the positron correction at the
+            // energy of the maximum cross section, which is the endpoint here
+            continue;
+        }
+
+        // Positron: rejection and tabulated sampling
+        const SBPositronXsCorrector scale_positron(
+            positron_mass,
+            this->material_params()->get(ElementId{0}),
+            gamma_cutoff,
+            e);
+        SBEnergyDistribution<SBPositronXsCorrector> sample_reject_pos(
+            helper, scale_positron);
+        SBCdfEnergyDistribution<SBPositronXsCorrector> sample_cdf_pos(
+            xs, e, ElementId{0}, dens_corr, gamma_cutoff, scale_positron);
+        expected = sample_many(inc_energy, sample_reject_pos);
+        actual   = sample_many(inc_energy, sample_cdf_pos);
+        expect_hist_near(expected, actual);
+    }
+
+    // Rejection and tabulated sampling for electrons, then for positrons at
+    // the higher energies: the tabulated sampling accepts nearly every trial
+    // clang-format off
+    const double expected_avg_engine_samples[] = {4.075439453125,
+        4.011474609375, 4.063232421875, 4.00390625, 5.108154296875,
+        4.10888671875, 5.165771484375, 4.1396484375, 4.67333984375,
+        4.07421875, 4.66796875, 4.073974609375, 4.456787109375,
+        4.058349609375, 4.46630859375, 4.053466796875, 4.33642578125,
+        4.034912109375, 4.35302734375, 4.039794921875};
+    // clang-format on
+    EXPECT_VEC_SOFT_EQ(expected_avg_engine_samples, avg_engine_samples);
+}
+
 TEST_F(SeltzerBergerTest, basic)
 {
     using celeritas::MaterialView;
@@ -22,16 +22,19 @@ class CalculatorTestBase : public celeritas::Test
   public:
     //!@{
     //! Type aliases
-    using real_type  = celeritas::real_type;
-    using size_type  = celeritas::size_type;
-    using XsGridData = celeritas::XsGridData;
-    using Values     = celeritas::Collection<real_type,
-                                         celeritas::Ownership::value,
-                                         celeritas::MemSpace::host>;
-    using Data       = celeritas::Collection<real_type,
-                                       celeritas::Ownership::const_reference,
-                                       celeritas::MemSpace::host>;
-    using SpanReal = celeritas::Span<real_type>;
+    using real_type       = celeritas::real_type;
+    using table_real_type = celeritas::table_real_type;
+    using size_type       = celeritas::size_type;
+    using XsGridData      = celeritas::XsGridData;
+    using SpanReal        = celeritas::Span<table_real_type>;
+    using Values
+        = celeritas::Collection<table_real_type,
+                                celeritas::Ownership::value,
+                                celeritas::MemSpace::host>;
+    using Data
+        = celeritas::Collection<table_real_type,
+                                celeritas::Ownership::const_reference,
+                                celeritas::MemSpace::host>;
     //!@}
 
   public:
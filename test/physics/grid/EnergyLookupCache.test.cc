@@ -0,0 +1,95 @@
+//----------------------------------*-C++-*----------------------------------//
+// Copyright 2021 UT-Battelle, LLC, and other Celeritas developers.
+// See the top-level COPYRIGHT file for details.
+// SPDX-License-Identifier: (Apache-2.0 OR MIT)
+//---------------------------------------------------------------------------//
+//! \file EnergyLookupCache.test.cc
+//---------------------------------------------------------------------------//
+#include "physics/grid/EnergyLookupCache.hh"
+
+#include <cmath>
+#include "physics/grid/RangeCalculator.hh"
+#include "physics/grid/XsCalculator.hh"
+#include "celeritas_test.hh"
+#include "CalculatorTestBase.hh"
+
+using namespace celeritas;
+
+//---------------------------------------------------------------------------//
+// TEST HARNESS
+//---------------------------------------------------------------------------//
+
+class EnergyLookupCacheTest : public celeritas_test::CalculatorTestBase
+{
+  protected:
+    using Energy = EnergyLookupCache::Energy;
+};
+
+//---------------------------------------------------------------------------//
+// TESTS
+//---------------------------------------------------------------------------//
+
+TEST_F(EnergyLookupCacheTest, find)
+{
+    EnergyLookupCache lookup(Energy{5});
+    EXPECT_SOFT_EQ(5, lookup.energy().value());
+    EXPECT_SOFT_EQ(std::log(5.0), lookup.log_energy());
+
+    // Energy from 1 to 1e5 MeV with 6 grid points
+    auto grid = UniformGridData::from_bounds(0, std::log(1e5), 6);
+
+    const auto& loc = lookup.find(grid);
+    EXPECT_EQ(0, loc.index);
+    EXPECT_SOFT_EQ(1, loc.lower_energy);
+    EXPECT_SOFT_EQ(10, loc.upper_energy);
+
+    // Identical grids reuse the cached location
+    auto same_grid = grid;
+    EXPECT_EQ(&loc, &lookup.find(same_grid));
+
+    // Different grids are looked up separately
+    auto other_grid = UniformGridData::from_bounds(
+        std::log(0.1), std::log(1e4), 11);
+    const auto& other_loc = lookup.find(other_grid);
+    EXPECT_NE(&loc, &other_loc);
+    EXPECT_EQ(3, other_loc.index);
+    EXPECT_SOFT_EQ(std::sqrt(10.0), other_loc.lower_energy);
+    EXPECT_SOFT_EQ(10, other_loc.upper_energy);
+
+    // Fill the cache past its capacity: results should be unaffected
+    for (int i : {2, 3, 4, 5, 6})
+    {
+        auto        g   = UniformGridData::from_bounds(0, std::log(1e5), 6 * i);
+        const auto& loc = lookup.find(g);
+        EXPECT_LE(loc.lower_energy, 5);
+        EXPECT_GT(loc.upper_energy, 5);
+    }
+    EXPECT_EQ(0, lookup.find(grid).index);
+    EXPECT_SOFT_EQ(10, lookup.find(grid).upper_energy);
+}
+
+TEST_F(EnergyLookupCacheTest, calculators)
+{
+    const real_type energies[] = {0.01, 0.1, 0.5, 1.0, 12.3, 1e4 - 1e-6, 1e5};
+
+    // Cross sections and ranges on the same grid share the lookup
+    this->build(0.1, 1e4, 6);
+    XsCalculator    calc_xs(this->data(), this->values());
+    RangeCalculator calc_range(this->data(), this->values());
+    for (real_type e : energies)
+    {
+        EnergyLookupCache lookup(Energy{e});
+        EXPECT_DOUBLE_EQ(calc_xs(Energy{e}), calc_xs(lookup));
+        EXPECT_DOUBLE_EQ(calc_range(Energy{e}), calc_range(lookup));
+    }
+
+    // Scaled cross sections
+    this->set_prime_index(2);
+    for (real_type e : energies)
+    {
+        EnergyLookupCache lookup(Energy{e});
+        EXPECT_DOUBLE_EQ(calc_xs(Energy{e}), calc_xs(lookup));
+        // Second evaluation uses the cached location
+        EXPECT_DOUBLE_EQ(calc_xs(Energy{e}), calc_xs(lookup));
+    }
+}
@@ -24,6 +24,9 @@ class GenericXsCalculatorTest : public celeritas_test::CalculatorTestBase
 {
   protected:
     using GenericGridData = celeritas::GenericGridData;
+    using Values
+        = Collection<real_type, Ownership::value, MemSpace::host>;
+    using Data = GenericXsCalculator::Values;
 
     void SetUp() override
     {
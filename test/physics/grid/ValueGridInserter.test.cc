@@ -20,8 +20,8 @@ using namespace celeritas;
 class ValueGridInserterTest : public celeritas::Test
 {
   protected:
-    Collection<real_type, Ownership::value, MemSpace::host>  real_storage;
-    Collection<XsGridData, Ownership::value, MemSpace::host> grid_storage;
+    ValueGridInserter::RealCollection   real_storage;
+    ValueGridInserter::XsGridCollection grid_storage;
 };
 
 //---------------------------------------------------------------------------//
@@ -57,4 +57,71 @@ TEST_F(ValueGridInserterTest, all)
         EXPECT_VEC_SOFT_EQ(values, real_storage[inserted.value]);
     }
     EXPECT_EQ(2, grid_storage.size());
+    EXPECT_EQ(0, insert.bytes_saved());
+}
+
+TEST_F(ValueGridInserterTest, deduplicate)
+{
+    const real_type values[]  = {10, 20, 3};
+    const real_type other[]   = {10, 20, 4};
+    const auto      grid      = UniformGridData::from_bounds(0.0, 1.0, 3);
+    const auto      fine_grid = UniformGridData::from_bounds(0.0, 0.5, 3);
+
+    ValueGridInserter insert(&real_storage, &grid_storage);
+    auto              first = insert(grid, make_span(values));
+    auto              diff  = insert(grid, make_span(other));
+    EXPECT_NE(first, diff);
+
+    // Identical grid is reused
+    EXPECT_EQ(first, insert(grid, make_span(values)));
+    EXPECT_EQ(2, grid_storage.size());
+    EXPECT_EQ(6, real_storage.size());
+
+    // Different energy grid or scaling reuses the values
+    auto fine  = insert(fine_grid, make_span(values));
+    auto prime = insert(grid, 1, make_span(values));
+    EXPECT_EQ(4, grid_storage.size());
+    EXPECT_EQ(6, real_storage.size());
+    EXPECT_EQ(grid_storage[first].value.begin()->get(),
+              grid_storage[fine].value.begin()->get());
+    EXPECT_EQ(grid_storage[first].value.begin()->get(),
+              grid_storage[prime].value.begin()->get());
+    EXPECT_EQ(3, grid_storage[fine].log_energy.size);
+    EXPECT_EQ(1, grid_storage[prime].prime_index);
+
+    EXPECT_EQ(9 * sizeof(table_real_type) + sizeof(XsGridData),
+              insert.bytes_saved());
+
+    // A new inserter reuses existing grids
+    ValueGridInserter other_insert(&real_storage, &grid_storage);
+    EXPECT_EQ(diff, other_insert(grid, make_span(other)));
+    EXPECT_EQ(4, grid_storage.size());
+}
+
+TEST_F(ValueGridInserterTest, deviation)
+{
+    // Cross sections with 1/E scaling, and a range table
+    const real_type xs[]    = {1.1, 2.3, 3.7, 4.1e3, 5.3e4};
+    const real_type range[] = {0.1, 1.3, 10.7, 100.9, 1000.1};
+    const auto      grid    = UniformGridData::from_bounds(-2.0, 2.0, 5);
+
+    ValueGridInserter insert(&real_storage, &grid_storage);
+    insert(grid, 3, make_span(xs));
+    EXPECT_EQ(0, insert.max_deviation().inverse);
+    insert(grid, make_span(range));
+
+    const auto& dev = insert.max_deviation();
+    if (CELERITAS_SINGLE_PRECISION_TABLES)
+    {
+        // Lookups differ by about the float rounding error
+        EXPECT_LT(0, dev.value);
+        EXPECT_GT(1e-6, dev.value);
+        EXPECT_LT(0, dev.inverse);
+        EXPECT_GT(1e-5, dev.inverse);
+    }
+    else
+    {
+        EXPECT_EQ(0, dev.value);
+        EXPECT_EQ(0, dev.inverse);
+    }
 }
@@ -0,0 +1,227 @@
+//----------------------------------*-C++-*----------------------------------//
+// Copyright 2021 UT-Battelle, LLC, and other Celeritas developers.
+// See the top-level COPYRIGHT file for details.
+// SPDX-License-Identifier: (Apache-2.0 OR MIT)
+//---------------------------------------------------------------------------//
+//! \file TabulatedElementSelector.test.cc
+//---------------------------------------------------------------------------//
+#include "physics/material/TabulatedElementSelector.hh"
+
+#include <cmath>
+#include <memory>
+#include <random>
+#include "celeritas_test.hh"
+#include "base/CollectionMirror.hh"
+#include "base/Range.hh"
+#include "random/SequenceEngine.hh"
+#include "physics/material/ElementCdfBuilder.hh"
+#include "physics/material/MaterialParams.hh"
+
+using namespace celeritas;
+using units::MevEnergy;
+
+//---------------------------------------------------------------------------//
+// TEST HARNESS
+//---------------------------------------------------------------------------//
+
+class TabulatedElementSelectorTest : public celeritas::Test
+{
+  public:
+    //!@{
+    //! Type aliases
+    using RandomEngine = std::mt19937;
+    using HostData     = ElementCdfBuilder::HostData;
+    using HostRef
+        = ElementCdfData<Ownership::const_reference, MemSpace::host>;
+    using VecInt = std::vector<int>;
+    //!@}
+
+  protected:
+    void SetUp() override
+    {
+        using celeritas::units::AmuMass;
+
+        MaterialParams::Input inp;
+        inp.elements = {
+            {1, AmuMass{1.008}, "H"},
+            {11, AmuMass{22.98976928}, "Na"},
+            {13, AmuMass{26.9815385}, "Al"},
+            {53, AmuMass{126.90447}, "I"},
+        };
+        inp.materials = {
+            {0.0, 0.0, MatterState::unspecified, {}, "hard_vacuum"},
+            {0.1 * constants::na_avogadro,
+             293.0,
+             MatterState::gas,
+             {{ElementId{2}, 1.0}},
+             "Al"},
+            {0.05 * constants::na_avogadro,
+             293.0,
+             MatterState::solid,
+             {{ElementId{0}, 0.25},
+              {ElementId{1}, 0.25},
+              {ElementId{2}, 0.25},
+              {ElementId{3}, 0.25}},
+             "everything_even"},
+            {1 * constants::na_avogadro,
+             293.0,
+             MatterState::solid,
+             {{ElementId{0}, 0.48},
+              {ElementId{1}, 0.24},
+              {ElementId{2}, 0.16},
+              {ElementId{3}, 0.12}},
+             "everything_weighted"},
+        };
+        mats = std::make_shared<MaterialParams>(std::move(inp));
+    }
+
+    //! Build tables on a grid of [1, 10, 100] MeV
+    void build(const ElementCdfBuilder::MicroXsFunc& calc_micro_xs)
+    {
+        ElementCdfBuilder build_cdf(*mats, MevEnergy{1}, MevEnergy{100}, 1);
+        data = build_cdf(calc_micro_xs);
+        ref  = data;
+    }
+
+    //! Sample elements in a material with a sequence of random numbers
+    VecInt sample(const char* mat, MevEnergy energy, std::vector<double> u)
+    {
+        TabulatedElementSelector select_el(ref, mats->find(mat), energy);
+        auto seq_rng
+            = celeritas_test::SequenceEngine::from_reals(make_span(u));
+        VecInt result;
+        while (seq_rng.count() < seq_rng.max_count())
+        {
+            result.push_back(select_el(seq_rng).unchecked_get());
+        }
+        return result;
+    }
+
+    std::shared_ptr<MaterialParams> mats;
+    HostData                        data;
+    HostRef                         ref;
+    RandomEngine                    rng;
+};
+
+// Return cross section proportional to the element ID offset by 1.
+real_type mock_micro_xs(ElementId el_id, MevEnergy)
+{
+    CELER_EXPECT(el_id < 4);
+    return static_cast<real_type>(el_id.get() + 1);
+}
+
+// Return a cross section that increases with energy only for hydrogen.
+real_type mock_energy_xs(ElementId el_id, MevEnergy energy)
+{
+    return el_id.get() == 0 ? energy.value() : 1;
+}
+
+//---------------------------------------------------------------------------//
+// TESTS
+//---------------------------------------------------------------------------//
+
+TEST_F(TabulatedElementSelectorTest, table)
+{
+    this->build(mock_micro_xs);
+    ASSERT_TRUE(data);
+    ASSERT_EQ(mats->num_materials(), data.materials.size());
+
+    // Single-element materials have no table
+    EXPECT_FALSE(data.materials[mats->find("hard_vacuum")]);
+    EXPECT_FALSE(data.materials[mats->find("Al")]);
+
+    const ElementCdfTable& table
+        = data.materials[mats->find("everything_even")];
+    ASSERT_TRUE(table);
+    EXPECT_EQ(3, table.log_energy.size);
+    EXPECT_SOFT_EQ(0, table.log_energy.front);
+    EXPECT_SOFT_EQ(std::log(100.0), table.log_energy.back);
+
+    const double expected_cdf[]
+        = {0.1, 0.3, 0.6, 1, 0.1, 0.3, 0.6, 1, 0.1, 0.3, 0.6, 1};
+    EXPECT_VEC_SOFT_EQ(expected_cdf, data.reals[table.cdf]);
+}
+
+TEST_F(TabulatedElementSelectorTest, zero_xs)
+{
+    // Fall back to the number fractions
+    this->build([](ElementId, MevEnergy) -> real_type { return 0; });
+    const ElementCdfTable& table
+        = data.materials[mats->find("everything_weighted")];
+    auto cdf = data.reals[table.cdf];
+    ASSERT_EQ(12, cdf.size());
+    const double expected_cdf[] = {0.48, 0.72, 0.88, 1};
+    EXPECT_VEC_SOFT_EQ(expected_cdf, cdf.subspan(8));
+}
+
+TEST_F(TabulatedElementSelectorTest, single)
+{
+    this->build(mock_micro_xs);
+    TabulatedElementSelector select_el(ref, mats->find("Al"), MevEnergy{5});
+    for (CELER_MAYBE_UNUSED auto i : range(100))
+    {
+        EXPECT_EQ(ElementComponentId{0}, select_el(rng));
+    }
+}
+
+TEST_F(TabulatedElementSelectorTest, everything_even)
+{
+    this->build(mock_micro_xs);
+    {
+        const int expected[] = {0, 0, 1, 1, 2, 2, 3, 3};
+        EXPECT_VEC_EQ(
+            expected,
+            this->sample("everything_even",
+                         MevEnergy{5},
+                         {0.0, 0.099, 0.101, 0.299, 0.301, 0.599, 0.601,
+                          0.999999}));
+    }
+
+    // Proportional to micro_xs (equal number density), identical to the
+    // results of ElementSelector
+    TabulatedElementSelector select_el(
+        ref, mats->find("everything_even"), MevEnergy{5});
+    std::vector<int> tally(4, 0);
+    for (CELER_MAYBE_UNUSED auto i : range(10000))
+    {
+        auto el_id = select_el(rng);
+        ASSERT_LT(el_id.get(), tally.size());
+        ++tally[el_id.get()];
+    }
+    const int expected_tally[] = {1032, 2014, 2971, 3983};
+    EXPECT_VEC_EQ(expected_tally, tally);
+}
+
+TEST_F(TabulatedElementSelectorTest, interpolate)
+{
+    this->build(mock_energy_xs);
+    const char mat[] = "everything_even";
+
+    // Below the grid: equiprobable
+    {
+        const int expected[] = {0, 1, 3};
+        EXPECT_VEC_EQ(expected,
+                      this->sample(mat, MevEnergy{0.1}, {0.249, 0.251, 0.99}));
+    }
+    // On the grid: exact probability 10/13 for hydrogen
+    {
+        const int expected[] = {0, 1};
+        EXPECT_VEC_EQ(
+            expected,
+            this->sample(mat, MevEnergy{10}, {0.7692, 0.7693}));
+    }
+    // Halfway between grid points in log energy
+    {
+        const int expected[] = {0, 1};
+        EXPECT_VEC_EQ(expected,
+                      this->sample(mat,
+                                   MevEnergy{std::sqrt(10.0)},
+                                   {0.5096, 0.5097}));
+    }
+    // Above the grid: probability 100/103 for hydrogen
+    {
+        const int expected[] = {0, 1};
+        EXPECT_VEC_EQ(expected,
+                      this->sample(mat, MevEnergy{1000}, {0.97, 0.971}));
+    }
+}
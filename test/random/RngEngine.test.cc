@@ -5,7 +5,9 @@
 //---------------------------------------------------------------------------//
 //! \file RngEngine.test.cc
 //---------------------------------------------------------------------------//
+#include "random/RngEngine.hh"
 #include "random/RngParams.hh"
+#include "random/detail/Philox.hh"
 #include "DiagnosticRngEngine.hh"
 #include "SequenceEngine.hh"
 
@@ -153,6 +155,128 @@ TEST(DiagnosticEngineTest, from_reals)
     EXPECT_EQ(0, rng.count());
 }
 
+//---------------------------------------------------------------------------//
+// PHILOX
+//---------------------------------------------------------------------------//
+
+TEST(PhiloxTest, known_answers)
+{
+    using celeritas::detail::philox4x32;
+    using celeritas::detail::PhiloxCounter;
+    using celeritas::detail::PhiloxKey;
+
+    // Known-answer tests from the Random123 library
+    auto result = philox4x32(PhiloxCounter{0u, 0u, 0u, 0u}, PhiloxKey{0u, 0u});
+    EXPECT_EQ(0x6627e8d5u, result[0]);
+    EXPECT_EQ(0xe169c58du, result[1]);
+    EXPECT_EQ(0xbc57ac4cu, result[2]);
+    EXPECT_EQ(0x9b00dbd8u, result[3]);
+
+    const unsigned int max = 0xffffffffu;
+    result = philox4x32(PhiloxCounter{max, max, max, max}, PhiloxKey{max, max});
+    EXPECT_EQ(0x408f276du, result[0]);
+    EXPECT_EQ(0x41c83b0eu, result[1]);
+    EXPECT_EQ(0xa20bc7c6u, result[2]);
+    EXPECT_EQ(0x6d5451fdu, result[3]);
+
+    result = philox4x32(
+        PhiloxCounter{0x243f6a88u, 0x85a308d3u, 0x13198a2eu, 0x03707344u},
+        PhiloxKey{0xa4093822u, 0x299f31d0u});
+    EXPECT_EQ(0xd16cfe09u, result[0]);
+    EXPECT_EQ(0x94fdccebu, result[1]);
+    EXPECT_EQ(0x5001e420u, result[2]);
+    EXPECT_EQ(0x24126ea1u, result[3]);
+}
+
+TEST(PhiloxTest, streams)
+{
+    using namespace celeritas::detail;
+
+    // Only the counter is stored for each stream
+    EXPECT_EQ(16, sizeof(PhiloxState));
+
+    const PhiloxKey key = philox_key(12345);
+    EXPECT_EQ(12345u, key[0]);
+    EXPECT_EQ(0u, key[1]);
+
+    PhiloxState a, b;
+    philox_select_stream(0, &a);
+    philox_select_stream(0, &b);
+    EXPECT_EQ(philox_next_word(key, &a), philox_next_word(key, &b));
+    EXPECT_EQ(1u, a.counter[0]);
+    EXPECT_EQ(0u, a.counter[2]);
+
+    // Restart one stream and select another
+    philox_select_stream(0, &a);
+    philox_select_stream((1ull << 32) | 2, &b);
+    EXPECT_EQ(0u, a.counter[0]);
+    EXPECT_EQ(2u, b.counter[2]);
+    EXPECT_EQ(1u, b.counter[3]);
+    EXPECT_NE(philox_next_word(key, &a), philox_next_word(key, &b));
+}
+
+TEST(PhiloxTest, words)
+{
+    using namespace celeritas::detail;
+
+    const PhiloxKey key = philox_key(12345);
+    PhiloxState     s;
+    philox_select_stream(3, &s);
+
+    // Words are drawn in order from each block of the stream
+    for (unsigned int i = 0; i < 3; ++i)
+    {
+        PhiloxCounter block = philox4x32({i, 0u, 3u, 0u}, key);
+        for (unsigned int word : block)
+        {
+            EXPECT_EQ(word, philox_next_word(key, &s));
+        }
+    }
+    EXPECT_EQ(12u, s.counter[0]);
+
+    // The word count carries into the second word of the counter
+    s.counter = {0xffffffffu, 0u, 3u, 0u};
+    EXPECT_EQ(philox4x32({0x3fffffffu, 0u, 3u, 0u}, key)[3],
+              philox_next_word(key, &s));
+    EXPECT_EQ(0u, s.counter[0]);
+    EXPECT_EQ(1u, s.counter[1]);
+    EXPECT_EQ(philox4x32({0x40000000u, 0u, 3u, 0u}, key)[0],
+              philox_next_word(key, &s));
+}
+
+#if CELERITAS_RNG == CELERITAS_RNG_PHILOX
+TEST(PhiloxRngEngineTest, host)
+{
+    using celeritas::RngEngine;
+    using RngHostStore = CollectionStateStore<RngStateData, MemSpace::host>;
+
+    RngParams    params(12345);
+    RngHostStore rng_store(params, 4);
+
+    // Slots start in distinct streams
+    using celeritas::ThreadId;
+    RngEngine first(params.host_ref(), rng_store.ref(), ThreadId{0});
+    RngEngine last(params.host_ref(), rng_store.ref(), ThreadId{3});
+    EXPECT_NE(first(), last());
+
+    // The same track stream gives the same values in any slot
+    first.select_stream(123);
+    last.select_stream(123);
+    for (int i = 0; i < 4; ++i)
+    {
+        EXPECT_EQ(first(), last());
+    }
+    double x = generate_canonical<double>(first);
+    EXPECT_EQ(x, generate_canonical<double>(last));
+    EXPECT_GE(x, 0);
+    EXPECT_LT(x, 1);
+    float y = generate_canonical<float>(first);
+    EXPECT_EQ(y, generate_canonical<float>(last));
+    EXPECT_GE(y, 0);
+    EXPECT_LT(y, 1);
+}
+#endif
+
 //---------------------------------------------------------------------------//
 // CUDA RNG
 //---------------------------------------------------------------------------//
@@ -173,7 +297,8 @@ TEST_F(CudaRngEngineTest, TEST_IF_CELERITAS_CUDA(device))
     RngDeviceStore rng_store(*params, 1024);
 
     // Generate on device
-    std::vector<unsigned int> values = re_test_native(rng_store.ref());
+    std::vector<unsigned int> values
+        = re_test_native(params->device_ref(), rng_store.ref());
 
     // Print a subset of the values
     std::vector<unsigned int> test_values;
@@ -182,6 +307,12 @@ TEST_F(CudaRngEngineTest, TEST_IF_CELERITAS_CUDA(device))
         test_values.push_back(values[i]);
     }
 
+    if (CELERITAS_RNG != CELERITAS_RNG_XORWOW)
+    {
+        // Expected values are for the cuRAND generator
+        return;
+    }
+
     // PRINT_EXPECTED(test_values);
     static const unsigned int expected_test_values[] = {165860337u,
                                                         3006138920u,
@@ -234,7 +365,8 @@ TYPED_TEST(CudaRngEngineFloatTest, DISABLED_device)
     RngDeviceStore rng_store(*this->params, 100);
 
     // Generate on device
-    auto values = re_test_canonical<real_type>(rng_store.ref());
+    auto values = re_test_canonical<real_type>(this->params->device_ref(),
+                                               rng_store.ref());
 
     // Test result
     EXPECT_EQ(rng_store.size(), values.size());
@@ -244,5 +376,8 @@ TYPED_TEST(CudaRngEngineFloatTest, DISABLED_device)
         EXPECT_LT(sample, real_type(1));
     }
 
-    check_expected_float_samples(values);
+    if (CELERITAS_RNG == CELERITAS_RNG_XORWOW)
+    {
+        check_expected_float_samples(values);
+    }
 }
@@ -25,26 +25,27 @@ namespace
 //---------------------------------------------------------------------------//
 
 __global__ void
-sample_native_kernel(RngStateData<Ownership::reference, MemSpace::device> view,
+sample_native_kernel(RngDeviceParamsRef      params,
+                     RngDeviceRef            view,
                      RngEngine::result_type* samples)
 {
     auto tid = celeritas::KernelParamCalculator::thread_id();
     if (tid.get() < view.size())
     {
-        RngEngine rng(view, tid);
+        RngEngine rng(params, view, tid);
         samples[tid.get()] = rng();
     }
 }
 
 template<class RealType>
-__global__ void
-sample_canonical_kernel(RngStateData<Ownership::reference, MemSpace::device> view,
-                        RealType* samples)
+__global__ void sample_canonical_kernel(RngDeviceParamsRef params,
+                                        RngDeviceRef       view,
+                                        RealType*          samples)
 {
     auto tid = celeritas::KernelParamCalculator::thread_id();
     if (tid.get() < view.size())
     {
-        RngEngine rng(view, tid);
+        RngEngine rng(params, view, tid);
         samples[tid.get()] = generate_canonical<RealType>(rng);
     }
 }
@@ -54,15 +55,16 @@ sample_canonical_kernel(RngStateData<Ownership::reference, MemSpace::device> vie
 // TESTING INTERFACE
 //---------------------------------------------------------------------------//
 //! Run on device and return results
-std::vector<unsigned int> re_test_native(RngDeviceRef states)
+std::vector<unsigned int>
+re_test_native(RngDeviceParamsRef params, RngDeviceRef states)
 {
     static const celeritas::KernelParamCalculator calc_launch_params(
         sample_native_kernel, "sample_native");
 
     thrust::device_vector<unsigned int> samples(states.size());
-    auto params = calc_launch_params(states.size());
-    sample_native_kernel<<<params.grid_size, params.block_size>>>(
-        states, raw_pointer_cast(samples.data()));
+    auto lparams = calc_launch_params(states.size());
+    sample_native_kernel<<<lparams.grid_size, lparams.block_size>>>(
+        params, states, raw_pointer_cast(samples.data()));
 
     std::vector<unsigned int> host_samples(states.size());
     thrust::copy(samples.begin(), samples.end(), host_samples.begin());
@@ -73,15 +75,16 @@ std::vector<unsigned int> re_test_native(RngDeviceRef states)
 //---------------------------------------------------------------------------//
 //! Run on device and return results
 template<class T>
-std::vector<T> re_test_canonical(RngDeviceRef states)
+std::vector<T>
+re_test_canonical(RngDeviceParamsRef params, RngDeviceRef states)
 {
     static const celeritas::KernelParamCalculator calc_launch_params(
         sample_canonical_kernel<T>, "sample_canonical");
 
     thrust::device_vector<T> samples(states.size());
-    auto                     params = calc_launch_params(states.size());
-    sample_canonical_kernel<<<params.grid_size, params.block_size>>>(
-        states, raw_pointer_cast(samples.data()));
+    auto                     lparams = calc_launch_params(states.size());
+    sample_canonical_kernel<<<lparams.grid_size, lparams.block_size>>>(
+        params, states, raw_pointer_cast(samples.data()));
 
     std::vector<T> host_samples(states.size());
     thrust::copy(samples.begin(), samples.end(), host_samples.begin());
@@ -93,8 +96,10 @@ std::vector<T> re_test_canonical(RngDeviceRef states)
 // EXPLICIT INSTANTIATION
 //---------------------------------------------------------------------------//
 
-template std::vector<float>  re_test_canonical<float>(RngDeviceRef);
-template std::vector<double> re_test_canonical<double>(RngDeviceRef);
+template std::vector<float>
+    re_test_canonical<float>(RngDeviceParamsRef, RngDeviceRef);
+template std::vector<double>
+    re_test_canonical<double>(RngDeviceParamsRef, RngDeviceRef);
 
 //---------------------------------------------------------------------------//
 } // namespace celeritas_test
@@ -17,24 +17,26 @@ using celeritas::Ownership;
 // TESTING INTERFACE
 //---------------------------------------------------------------------------//
 //! Input data
+using RngDeviceParamsRef
+    = celeritas::RngParamsData<Ownership::const_reference, MemSpace::device>;
 using RngDeviceRef
     = celeritas::RngStateData<Ownership::reference, MemSpace::device>;
 
 //---------------------------------------------------------------------------//
 //! Run on device and return results
-std::vector<unsigned int> re_test_native(RngDeviceRef);
+std::vector<unsigned int> re_test_native(RngDeviceParamsRef, RngDeviceRef);
 
 template<class T>
-std::vector<T> re_test_canonical(RngDeviceRef);
+std::vector<T> re_test_canonical(RngDeviceParamsRef, RngDeviceRef);
 
 #if !CELERITAS_USE_CUDA
-std::vector<unsigned int> re_test_native(RngDeviceRef)
+std::vector<unsigned int> re_test_native(RngDeviceParamsRef, RngDeviceRef)
 {
     CELER_NOT_CONFIGURED("CUDA");
 }
 
 template<class T>
-inline std::vector<T> re_test_canonical(RngDeviceRef)
+inline std::vector<T> re_test_canonical(RngDeviceParamsRef, RngDeviceRef)
 {
     CELER_NOT_CONFIGURED("CUDA");
 }
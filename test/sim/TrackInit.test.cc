@@ -10,7 +10,9 @@
 #include <algorithm>
 #include <numeric>
 #include "celeritas_test.hh"
+#include "base/CollectionAlgorithms.hh"
 #include "base/CollectionStateStore.hh"
+#include "base/Range.hh"
 #include "geometry/GeoParams.hh"
 #include "geometry/GeoMaterialParams.hh"
 #include "physics/base/CutoffParams.hh"
@@ -335,5 +337,157 @@ TEST_F(TrackInitTest, secondaries)
     }
 }
 
+TEST_F(TrackInitTest, overflow)
+{
+    const size_type num_tracks = 512;
+
+    // Allocate storage for only one initializer per track
+    track_inits = std::make_shared<TrackInitParams>(
+        TrackInitParams::Input{generate_primaries(num_tracks), 1});
+
+    build_states(num_tracks, 4);
+    std::vector<TrackInitializer> overflow;
+
+    // Every track survives and produces one secondary
+    std::vector<size_type> alloc(num_tracks, 1);
+    std::vector<char>      alive(num_tracks, 1);
+    ITTestInput            input(alloc, alive);
+
+    extend_from_primaries(track_inits->host_ref(), &track_init_states);
+    for (int i = 0; i < 2; ++i)
+    {
+        initialize_tracks(params, states, &track_init_states);
+        interact(states, input.device_ref());
+        extend_from_secondaries(
+            params, states, &track_init_states, &overflow);
+    }
+
+    // The secondaries from the first step were moved to the host to make
+    // room for the secondaries from the second step
+    EXPECT_EQ(num_tracks, track_init_states.initializers.size());
+    EXPECT_EQ(num_tracks, overflow.size());
+
+    ITTestOutput output, expected;
+    output.init_id = initializers_test(make_ref(track_init_states));
+    expected.init_id.resize(num_tracks);
+    std::iota(expected.init_id.begin(), expected.init_id.end(), 2 * num_tracks);
+    std::sort(output.init_id.begin(), output.init_id.end());
+    EXPECT_VEC_EQ(expected.init_id, output.init_id);
+
+    // Kill all the tracks without producing secondaries
+    std::vector<size_type> no_alloc(num_tracks, 0);
+    std::vector<char>      dead(num_tracks, 0);
+    ITTestInput            kill(no_alloc, dead);
+
+    interact(states, kill.device_ref());
+    extend_from_secondaries(params, states, &track_init_states, &overflow);
+    EXPECT_EQ(num_tracks, overflow.size());
+
+    // Initialize the secondaries from the second step, then kill them to
+    // free space for the buffered initializers
+    initialize_tracks(params, states, &track_init_states);
+    interact(states, kill.device_ref());
+    extend_from_secondaries(params, states, &track_init_states, &overflow);
+    EXPECT_EQ(0, overflow.size());
+    EXPECT_EQ(num_tracks, track_init_states.initializers.size());
+
+    // The buffered secondaries from the first step are initialized last
+    initialize_tracks(params, states, &track_init_states);
+    EXPECT_EQ(0, track_init_states.initializers.size());
+
+    output.track_id = tracks_test(states);
+    expected.track_id.resize(num_tracks);
+    std::iota(expected.track_id.begin(), expected.track_id.end(), num_tracks);
+    std::sort(output.track_id.begin(), output.track_id.end());
+    EXPECT_VEC_EQ(expected.track_id, output.track_id);
+}
+
+TEST_F(TrackInitTest, compact)
+{
+    const size_type num_tracks = 10;
+
+    track_inits = std::make_shared<TrackInitParams>(
+        TrackInitParams::Input{generate_primaries(num_tracks), 2});
+    build_states(num_tracks, 2);
+
+    // Copy track slot data to host
+    auto get_alive = [this] {
+        std::vector<SimTrackState> sim(num_tracks);
+        copy_to_host(device_states.sim.state, make_span(sim));
+        std::vector<char> result;
+        for (const auto& s : sim)
+        {
+            result.push_back(s.alive);
+        }
+        return result;
+    };
+    auto get_energy = [this] {
+        std::vector<ParticleTrackState> particles(num_tracks);
+        copy_to_host(device_states.particles.state, make_span(particles));
+        std::vector<real_type> result;
+        for (const auto& p : particles)
+        {
+            result.push_back(p.energy.value());
+        }
+        return result;
+    };
+    auto get_edep = [this] {
+        std::vector<real_type> result(num_tracks);
+        copy_to_host(device_states.energy_deposition, make_span(result));
+        return result;
+    };
+    auto live_energy = [&] {
+        std::vector<char>      alive  = get_alive();
+        std::vector<real_type> energy = get_energy();
+        real_type              result = 0;
+        for (auto i : range(num_tracks))
+        {
+            result += alive[i] ? energy[i] : 0;
+        }
+        return result;
+    };
+
+    // Initialize tracks 0-9 with energies 1-10 MeV in slots 0-9
+    extend_from_primaries(track_inits->host_ref(), &track_init_states);
+    initialize_tracks(params, states, &track_init_states);
+    fill(real_type(1), &device_states.energy_deposition);
+
+    // Kill every other track without producing secondaries
+    std::vector<size_type> alloc(num_tracks, 0);
+    std::vector<char>      alive = {0, 1, 0, 1, 0, 1, 0, 1, 0, 1};
+    ITTestInput            input(alloc, alive);
+    interact(states, input.device_ref());
+    extend_from_secondaries(params, states, &track_init_states);
+    EXPECT_EQ(num_tracks, states.num_active);
+    real_type energy_before = live_energy();
+    EXPECT_SOFT_EQ(2 + 4 + 6 + 8 + 10, energy_before);
+
+    compact_tracks(params, &states, &track_init_states);
+
+    // Live tracks in slots 5, 7, 9 fill the holes at 0, 2, 4
+    EXPECT_EQ(5, states.num_active);
+    ITTestOutput output, expected;
+    output.track_id = tracks_test(states);
+    output.track_id.resize(states.num_active);
+    expected.track_id = {5, 1, 7, 3, 9};
+    EXPECT_VEC_EQ(expected.track_id, output.track_id);
+
+    const char expected_alive[] = {1, 1, 1, 1, 1, 0, 0, 0, 0, 0};
+    EXPECT_VEC_EQ(expected_alive, get_alive());
+    const double expected_energy[] = {6, 2, 8, 4, 10};
+    EXPECT_VEC_SOFT_EQ(expected_energy,
+                       make_span(get_energy()).first(states.num_active));
+    EXPECT_SOFT_EQ(energy_before, live_energy());
+
+    // Vacated slots no longer hold stale energy deposition
+    const double expected_edep[] = {1, 1, 1, 1, 1, 0, 0, 0, 0, 0};
+    EXPECT_VEC_SOFT_EQ(expected_edep, get_edep());
+
+    // New tracks fill the lowest empty slots first
+    output.vacancy   = vacancies_test(make_ref(track_init_states));
+    expected.vacancy = {9, 8, 7, 6, 5};
+    EXPECT_VEC_EQ(expected.vacancy, output.vacancy);
+}
+
 //---------------------------------------------------------------------------//
 } // namespace celeritas_test